@@ -3,11 +3,23 @@
  * @brief Implémentation de l'intelligence artificielle
  */
 
+#include <pthread.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
+#include <unistd.h>
 #include "./ai.h"
 #include "./logic.h"
+#include "./mcts.h"
+
+/**
+ * La table de coups parfaits ne couvre que le plateau 3x3 ; le
+ * générateur de la table compile ce fichier avec AI_NO_LOOKUP_TABLE.
+ */
+#ifndef AI_NO_LOOKUP_TABLE
+#include "./ai_table.h"
+#endif
 
 /*********************************
  * Fonctions utilitaires statiques
@@ -28,182 +40,1260 @@ static inline int min(int a, int b) {
 }
 
 /**
- * @brief Vérifie si un coup permet une victoire immédiate
+ * @brief Trouve une case vide aléatoire
  * 
  * @param game État du jeu
- * @param position Position à tester
- * @param player Joueur à vérifier
- * @return 1 si le coup est gagnant, 0 sinon
+ * @param ai IA dont le générateur fait le tirage
+ * @return Position choisie, -1 si aucune case disponible
  */
-static int is_winning_move(game_t* game, int position, int player) {
-    if (game->board[position] != EMPTY) {
+static int find_random_empty_cell(const game_t* game, ai_t* ai) {
+    int candidates[MAX_CELLS];
+    int count = 0;
+
+    // Collecte des cases vides
+    for (int i = 0; i < game->config->cell_count; i++) {
+        if (get_cell(game, i) == EMPTY) {
+            candidates[count++] = i;
+        }
+    }
+
+    return (count > 0) ? candidates[rng_below(&ai->rng, count)] : -1;
+}
+
+/*********************************
+ * Table de transposition
+ *********************************/
+
+/** @brief Nombre de bits d'index de la table de transposition */
+#define TT_BITS 20
+
+/** @brief Nombre d'entrées de la table de transposition */
+#define TT_SIZE (1u << TT_BITS)
+
+/** @brief Borne au-delà de laquelle un score correspond à une fin de partie */
+#define SCORE_WIN_THRESHOLD (SCORE_WIN - MAX_CELLS - 1)
+
+/**
+ * @brief Nombre de cases jusqu'auquel la recherche va jusqu'en fin de partie
+ *
+ * Au-delà, l'arbre complet est hors de portée et la recherche s'arrête à
+ * AI_LARGE_BOARD_DEPTH demi-coups, les positions non terminales recevant
+ * alors une évaluation statique (evaluate_position).
+ */
+#define AI_EXACT_SEARCH_CELLS 16
+#define AI_LARGE_BOARD_DEPTH 4
+
+/** @brief Borne de l'évaluation statique, en deçà de toute fin de partie */
+#define AI_EVAL_MAX (SCORE_WIN_THRESHOLD - 1)
+
+/** @brief Nombre de nœuds entre deux consultations de ai_t.stop_flag (puissance de 2) */
+#define AI_STOP_CHECK_NODES 1024
+
+/** @brief Nombre de coups à la racine en dessous duquel la recherche reste séquentielle */
+#define AI_PARALLEL_MIN_MOVES 8
+
+/**
+ * @brief Priorités du tri des coups, de la plus forte à la plus faible
+ *
+ * Les coups sans priorité particulière sont classés par l'historique,
+ * puis par le nombre de lignes gagnantes passant par la case (centre,
+ * puis coins sur le 3x3).
+ */
+#define ORDER_HASH_MOVE (1 << 30)  /**< Meilleur coup mémorisé dans la table */
+#define ORDER_WIN       (1 << 29)  /**< Complète une ligne */
+#define ORDER_BLOCK     (1 << 28)  /**< Empêche l'adversaire de compléter une ligne */
+#define ORDER_KILLER    (1 << 27)  /**< A provoqué une coupure au même demi-coup */
+
+/** @brief Valeur d'historique au-delà de laquelle la table est divisée par deux */
+#define AI_HISTORY_MAX (1 << 20)
+
+/** @brief Nature du score stocké dans une entrée */
+typedef enum {
+    TT_EXACT = 0,  /**< Score exact */
+    TT_LOWER = 1,  /**< Borne inférieure (coupure beta) */
+    TT_UPPER = 2   /**< Borne supérieure (aucun coup n'a dépassé alpha) */
+} TTFlag;
+
+/**
+ * @brief Entrée de la table de transposition, partagée sans verrou
+ *
+ * data regroupe score, coup, nature, profondeur et génération dans un
+ * seul mot et check vaut key ^ data. Deux threads peuvent écrire la même
+ * entrée en même temps : un mélange de deux écritures ne vérifie plus
+ * check ^ data == key et est simplement ignoré à la lecture.
+ */
+typedef struct {
+    _Atomic uint64_t check;  /**< Clé de Zobrist complète XOR data */
+    _Atomic uint64_t data;   /**< Contenu compacté (voir tt_pack) */
+} tt_entry_t;
+
+/** @brief Contenu d'une entrée de la table */
+typedef struct {
+    int score;      /**< Score relatif à la position (voir score_to_tt) */
+    int best_move;  /**< Meilleur coup trouvé, -1 si inconnu */
+    int flag;       /**< TTFlag */
+    int depth;      /**< Profondeur restante de la recherche qui a produit l'entrée */
+} tt_data_t;
+
+static tt_entry_t transposition_table[TT_SIZE];
+
+/**
+ * @brief Génération de la table, sur 16 bits
+ *
+ * Chaque entrée garde la génération qui l'a écrite et n'est lue que dans
+ * cette génération : vider la table revient à en changer, sans parcourir
+ * ses TT_SIZE entrées. Elle n'est réellement effacée que lorsque le
+ * compteur fait le tour.
+ */
+static atomic_uint tt_generation = 0;
+
+/**
+ * @brief Lit l'entrée correspondant à une clé
+ * @return 1 si l'entrée contient cette position, 0 sinon
+ */
+static inline int tt_probe(uint64_t key, tt_data_t* out) {
+    const tt_entry_t* entry = &transposition_table[key & (TT_SIZE - 1)];
+    const uint64_t data = atomic_load_explicit(&entry->data, memory_order_relaxed);
+    const uint64_t check = atomic_load_explicit(&entry->check, memory_order_relaxed);
+
+    if ((check ^ data) != key ||
+        (data >> 48) != atomic_load_explicit(&tt_generation, memory_order_relaxed)) {
         return 0;
     }
-    
-    // Simule le coup
-    int original = game->board[position];
-    game->board[position] = player;
-    int result = check_player_won(game, player);
-    
-    // Restaure l'état
-    game->board[position] = original;
-    
-    return result;
+
+    out->score = (int16_t)(data & 0xFFFF);
+    out->best_move = (int16_t)((data >> 16) & 0xFFFF);
+    out->flag = (int)((data >> 32) & 0xFF);
+    out->depth = (int)((data >> 40) & 0xFF);
+    return 1;
 }
 
 /**
- * @brief Trouve une case vide aléatoire
- * 
- * @param game État du jeu
- * @return Position choisie, -1 si aucune case disponible
+ * @brief Écrit une entrée (remplacement systématique)
  */
-static int find_random_empty_cell(const game_t* game) {
-    int empty_cells[N * N];
-    int count = 0;
+static inline void tt_store(uint64_t key, int score, int best_move, int flag, int depth) {
+    tt_entry_t* entry = &transposition_table[key & (TT_SIZE - 1)];
+    const unsigned int generation = atomic_load_explicit(&tt_generation, memory_order_relaxed);
+    const uint64_t data = (uint64_t)(uint16_t)score
+                        | (uint64_t)(uint16_t)best_move << 16
+                        | (uint64_t)(uint8_t)flag << 32
+                        | (uint64_t)(uint8_t)depth << 40
+                        | (uint64_t)generation << 48;
 
-    // Collecte des cases vides
-    for (int i = 0; i < N * N; i++) {
-        if (game->board[i] == EMPTY) {
-            empty_cells[count++] = i;
+    atomic_store_explicit(&entry->data, data, memory_order_relaxed);
+    atomic_store_explicit(&entry->check, key ^ data, memory_order_relaxed);
+}
+
+/**
+ * @brief Clés de Zobrist : une par joueur et par case, plus le trait
+ *
+ * zobrist_base est incluse dans toute clé pour qu'aucune position n'ait
+ * la clé nulle des entrées vides de la table.
+ */
+static uint64_t zobrist_keys[2][MAX_CELLS];
+static uint64_t zobrist_side;
+static uint64_t zobrist_base;
+
+/**
+ * @brief Initialise les clés de Zobrist et vide la table
+ */
+static void init_search_tables(void) {
+    // Clés fixes d'une exécution à l'autre : les parcours restent reproductibles
+    uint64_t state = 0x5EED5EED5EED5EEDull;
+
+    for (int i = 0; i < MAX_CELLS; i++) {
+        zobrist_keys[PLAYER_INDEX(PLAYER_X)][i] = rng_splitmix64(&state);
+        zobrist_keys[PLAYER_INDEX(PLAYER_O)][i] = rng_splitmix64(&state);
+    }
+    zobrist_side = rng_splitmix64(&state);
+    zobrist_base = rng_splitmix64(&state);
+
+    // Table vidée en changeant de génération, effacée quand le compteur fait le tour
+    const unsigned int generation = (atomic_load(&tt_generation) + 1) & 0xFFFF;
+    if (generation == 0) {
+        for (unsigned int i = 0; i < TT_SIZE; i++) {
+            atomic_store_explicit(&transposition_table[i].check, 0, memory_order_relaxed);
+            atomic_store_explicit(&transposition_table[i].data, 0, memory_order_relaxed);
         }
     }
+    atomic_store(&tt_generation, generation);
+}
 
-    return (count > 0) ? empty_cells[rand() % count] : -1;
+/**
+ * @brief Clé propre à une configuration de plateau
+ *
+ * Deux plateaux de tailles différentes peuvent avoir les mêmes index de
+ * cases occupées : cette clé les distingue dans la table.
+ */
+static uint64_t config_key(const board_config_t* config) {
+    uint64_t state = zobrist_base ^ ((uint64_t)config->width
+                                   | (uint64_t)config->height << 8
+                                   | (uint64_t)config->win_length << 16);
+    return rng_splitmix64(&state);
 }
 
+/*********************************
+ * Symétries du plateau
+ *********************************/
+
 /**
- * @brief Évalue la position actuelle pour Minimax
- * 
+ * @brief Calcule les clés de Zobrist d'une position pour chaque symétrie
+ *
+ * La clé pour la symétrie t est celle de la position transformée par t :
+ * chaque pion en case i contribue zobrist_keys[p][symmetry_map[t][i]]. En
+ * tenant à jour une clé par symétrie, on obtient la clé de chacune des
+ * positions équivalentes sans jamais transformer le plateau.
+ *
+ * Utilisée une seule fois à la racine, la recherche met ensuite
+ * les clés à jour de manière incrémentale.
+ *
  * @param game État du jeu
- * @return Score de la position (-10 à +10)
+ * @param player Joueur au trait
+ * @param symmetries Nombre de symétries prises en compte
+ * @param hashes Reçoit une clé par symétrie
+ */
+static void compute_hashes(const game_t* game, int player, int symmetries, uint64_t* hashes) {
+    const board_config_t* config = game->config;
+    const uint64_t base = config_key(config) ^ ((player == PLAYER_O) ? zobrist_side : 0);
+
+    for (int t = 0; t < symmetries; t++) {
+        uint64_t hash = base;
+
+        for (int p = 0; p < 2; p++) {
+            bitboard_t stones = game->boards[p];
+            int i;
+            while ((i = bitboard_pop_lowest(&stones)) >= 0) {
+                hash ^= zobrist_keys[p][config->symmetry_map[t][i]];
+            }
+        }
+
+        hashes[t] = hash;
+    }
+}
+
+/**
+ * @brief Choisit la clé canonique parmi les positions symétriques
+ *
+ * Le représentant canonique est la position dont la clé est la plus petite ;
+ * toutes les positions équivalentes partagent donc la même entrée.
+ *
+ * @param hashes Clés de la position pour chaque symétrie
+ * @param symmetries Nombre de symétries prises en compte
+ * @param transform Reçoit la symétrie menant au représentant canonique
+ * @return Clé canonique
+ */
+static uint64_t canonical_key(const uint64_t* hashes, int symmetries, int* transform) {
+    uint64_t key = hashes[0];
+    *transform = 0;
+
+    for (int t = 1; t < symmetries; t++) {
+        if (hashes[t] < key) {
+            key = hashes[t];
+            *transform = t;
+        }
+    }
+
+    return key;
+}
+
+/**
+ * @brief Convertit un score relatif à la racine en score relatif au nœud
+ *
+ * Les scores de victoire dépendent de la distance à la racine ; on stocke
+ * la distance depuis le nœud pour que l'entrée reste valable quel que soit
+ * le chemin qui y mène.
  */
-static int evaluate_board(const game_t* game) {
-    if (check_player_won(game, PLAYER_O)) return SCORE_WIN;    // Victoire IA
-    if (check_player_won(game, PLAYER_X)) return SCORE_LOSS;   // Victoire joueur
-    return SCORE_DRAW;  // Match nul ou partie en cours
+static int score_to_tt(int score, int ply) {
+    if (score > SCORE_WIN_THRESHOLD) return score + ply;
+    if (score < -SCORE_WIN_THRESHOLD) return score - ply;
+    return score;
 }
 
 /**
- * @brief Implémentation de l'algorithme Minimax
- * 
+ * @brief Opération inverse de score_to_tt
+ */
+static int score_from_tt(int score, int ply) {
+    if (score > SCORE_WIN_THRESHOLD) return score - ply;
+    if (score < -SCORE_WIN_THRESHOLD) return score + ply;
+    return score;
+}
+
+/**
+ * @brief Horloge monotone en millisecondes
+ */
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec * 1e-6;
+}
+
+/**
+ * @brief Indique si la recherche doit s'arrêter (demande extérieure ou
+ * échéance dépassée)
+ */
+static int should_stop(const ai_t* ai) {
+    if (ai->stop_flag && atomic_load_explicit(ai->stop_flag, memory_order_relaxed)) {
+        return 1;
+    }
+    return ai->deadline_ms > 0 && now_ms() >= ai->deadline_ms;
+}
+
+/**
+ * @brief Met à jour les clés de chaque symétrie après un coup
+ */
+static inline void child_hashes(const board_config_t* config, const uint64_t* hashes,
+                                int symmetries, int player, int cell, uint64_t* child) {
+    for (int t = 0; t < symmetries; t++) {
+        child[t] = hashes[t] ^ zobrist_side
+                 ^ zobrist_keys[PLAYER_INDEX(player)][config->symmetry_map[t][cell]];
+    }
+}
+
+/*********************************
+ * Ordonnancement des coups
+ *********************************/
+
+/** @brief Coups d'un nœud et leur priorité */
+typedef struct {
+    int count;
+    int16_t cells[MAX_CELLS];
+    int scores[MAX_CELLS];
+} move_list_t;
+
+/**
+ * @brief Cases à essayer depuis une position
+ *
+ * Sur les plateaux trop grands pour une recherche exhaustive, seules les
+ * cases vides voisines d'un pion (voir board_config_t.neighborhood) sont
+ * retenues ; toutes les cases vides sinon, ou si le plateau est vide.
+ */
+static bitboard_t candidate_cells(const game_t* game) {
+    const board_config_t* config = game->config;
+    bitboard_t empty = empty_cells(game);
+
+    if (config->cell_count <= AI_EXACT_SEARCH_CELLS) {
+        return empty;
+    }
+
+    bitboard_t near;
+    bitboard_clear_all(&near);
+    for (int p = 0; p < 2; p++) {
+        bitboard_t stones = game->boards[p];
+        int i;
+        while ((i = bitboard_pop_lowest(&stones)) >= 0) {
+            bitboard_or_assign(&near, &config->neighborhood[i]);
+        }
+    }
+
+    near = bitboard_and(&near, &empty);
+    return bitboard_is_empty(&near) ? empty : near;
+}
+
+/**
+ * @brief Indique si jouer en cell complète une ligne de player
+ *
+ * Une ligne comptant win_length - 1 pions de player et passant par une
+ * case vide ne peut contenir que cette case en plus.
+ */
+static inline int completes_line(const game_t* game, int cell, int player) {
+    const board_config_t* config = game->config;
+    const int16_t* lines = config->cell_lines[cell];
+    const uint8_t* counts = game->line_counts[PLAYER_INDEX(player)];
+
+    for (int i = 0; i < config->cell_line_count[cell]; i++) {
+        if (counts[lines[i]] == config->win_length - 1) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Construit la liste des coups d'un nœud
+ *
+ * Avec ai->use_move_ordering, chaque coup reçoit une priorité : victoire
+ * immédiate, parade, coups meurtriers (killer moves) du demi-coup, puis
+ * historique et position. Sans tri, les cases restent dans l'ordre des
+ * index.
+ *
+ * @param ai Configuration de l'IA (coups meurtriers, historique)
+ * @param game Position courante
+ * @param player Joueur au trait
+ * @param ply Distance à la racine
+ * @param skip Coup déjà essayé, à exclure (-1 : aucun)
+ * @param list Reçoit les coups
+ */
+static void generate_moves(const ai_t* ai, const game_t* game, int player, int ply,
+                           int skip, move_list_t* list) {
+    const board_config_t* config = game->config;
+    const int opponent = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    const int* history = ai->history[PLAYER_INDEX(player)];
+    const int16_t* killers = ai->killer_moves[ply];
+    bitboard_t moves = candidate_cells(game);
+    int i;
+
+    list->count = 0;
+    while ((i = bitboard_pop_lowest(&moves)) >= 0) {
+        int score;
+        if (i == skip) {
+            continue;
+        } else if (!ai->use_move_ordering) {
+            score = 0;
+        } else if (completes_line(game, i, player)) {
+            score = ORDER_WIN;
+        } else if (completes_line(game, i, opponent)) {
+            score = ORDER_BLOCK;
+        } else if (i == killers[0]) {
+            score = ORDER_KILLER + 1;
+        } else if (i == killers[1]) {
+            score = ORDER_KILLER;
+        } else {
+            score = history[i] * MAX_LINES_PER_CELL + config->cell_line_count[i];
+        }
+
+        list->cells[list->count] = (int16_t)i;
+        list->scores[list->count] = score;
+        list->count++;
+    }
+}
+
+/**
+ * @brief Amène en position next le coup restant de plus forte priorité
+ *
+ * Tri par sélection au fur et à mesure : après une coupure, les coups
+ * restants n'ont jamais besoin d'être triés.
+ *
+ * @param list Coups, ceux d'index inférieur à next étant déjà essayés
+ * @param next Position du coup à prendre
+ * @return Case du coup
+ */
+static inline int next_move(move_list_t* list, int next) {
+    int best = next;
+    for (int m = next + 1; m < list->count; m++) {
+        if (list->scores[m] > list->scores[best]) {
+            best = m;
+        }
+    }
+
+    const int16_t cell = list->cells[best];
+    const int score = list->scores[best];
+    list->cells[best] = list->cells[next];
+    list->scores[best] = list->scores[next];
+    list->cells[next] = cell;
+    list->scores[next] = score;
+    return cell;
+}
+
+/**
+ * @brief Retient un coup ayant provoqué une coupure
+ *
+ * Les victoires et parades, déjà prioritaires, ne sont pas retenues.
+ */
+static void record_cutoff(ai_t* ai, int player, int ply, int depth, int cell, int score) {
+    if (score >= ORDER_BLOCK && score < ORDER_HASH_MOVE) {
+        return;
+    }
+
+    int16_t* killers = ai->killer_moves[ply];
+    if (killers[0] != cell) {
+        killers[1] = killers[0];
+        killers[0] = (int16_t)cell;
+    }
+
+    int* history = ai->history[PLAYER_INDEX(player)];
+    history[cell] += depth * depth;
+    if (history[cell] > AI_HISTORY_MAX) {
+        for (int i = 0; i < MAX_CELLS; i++) {
+            history[i] /= 2;
+        }
+    }
+}
+
+/**
+ * @brief Oublie les coups meurtriers et l'historique (nouvelle recherche)
+ */
+static void clear_move_ordering(ai_t* ai) {
+    for (int ply = 0; ply < MAX_CELLS; ply++) {
+        ai->killer_moves[ply][0] = -1;
+        ai->killer_moves[ply][1] = -1;
+    }
+    for (int i = 0; i < MAX_CELLS; i++) {
+        ai->history[0][i] = 0;
+        ai->history[1][i] = 0;
+    }
+}
+
+/*********************************
+ * Évaluation statique
+ *********************************/
+
+/**
+ * @brief Poids d'une ligne occupée par un seul joueur, selon le nombre
+ * de symboles qui lui manquent pour la compléter
+ */
+static const int line_weights[] = {0, 256, 64, 16, 4};
+
+/**
+ * @brief Évaluation d'une position non terminale, à l'horizon de la recherche
+ *
+ * Lue dans les compteurs de lignes (line_counts) : chaque ligne gagnante
+ * occupée par un seul joueur compte pour lui, d'autant plus qu'il lui
+ * manque peu de symboles (alignements ouverts de trois, quatre...). Une
+ * ligne à laquelle il ne manque qu'un symbole du joueur au trait est une
+ * victoire au coup suivant. Le score reste dans [-AI_EVAL_MAX, AI_EVAL_MAX],
+ * sans jamais se confondre avec une fin de partie.
+ *
  * @param game État du jeu
- * @param depth Profondeur actuelle
- * @param is_maximizing true pour maximiser, false pour minimiser
+ * @param player Joueur au trait, du point de vue duquel le score est donné
+ * @return Score de la position
+ */
+static int evaluate_position(const game_t* game, int player) {
+    const board_config_t* config = game->config;
+    const int opponent = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    const uint8_t* own = game->line_counts[PLAYER_INDEX(player)];
+    const uint8_t* other = game->line_counts[PLAYER_INDEX(opponent)];
+    const int max_missing = (int)(sizeof(line_weights) / sizeof(line_weights[0])) - 1;
+    int score = 0;
+
+    for (int l = 0; l < config->line_count; l++) {
+        if (own[l] != 0 && other[l] == 0) {
+            const int missing = config->win_length - own[l];
+            if (missing == 1) {
+                return AI_EVAL_MAX;
+            }
+            score += (missing <= max_missing) ? line_weights[missing] : 1;
+        } else if (other[l] != 0 && own[l] == 0) {
+            const int missing = config->win_length - other[l];
+            score -= (missing <= max_missing) ? line_weights[missing] : 1;
+        }
+    }
+
+    return max(-AI_EVAL_MAX, min(AI_EVAL_MAX, score));
+}
+
+/*********************************
+ * Recherche Minimax
+ *********************************/
+
+/**
+ * @brief Implémentation de Minimax (forme negamax) avec élagage alpha-beta
+ *
+ * Le score est exprimé du point de vue du joueur au trait. Une victoire
+ * obtenue au demi-coup ply vaut SCORE_WIN - ply, ce qui fait préférer
+ * les victoires rapides et les défaites lentes.
+ *
+ * Les résultats sont rangés sous la clé canonique de la position : le
+ * meilleur coup y est stocké dans le repère du représentant canonique.
+ *
+ * @param ai Configuration de l'IA (compteur de nœuds, symétries)
+ * @param game État du jeu, modifié puis restauré pendant la recherche
+ * @param player Joueur au trait
+ * @param hashes Clés de Zobrist de la position pour chaque symétrie
+ * @param ply Distance à la racine en demi-coups
+ * @param depth Profondeur restante en demi-coups
+ * @param alpha Borne inférieure de la fenêtre
+ * @param beta Borne supérieure de la fenêtre
+ * @param best_move Reçoit le meilleur coup (peut être NULL)
  * @return Meilleur score possible depuis cette position
  */
-static int minimax(game_t* game, int depth, int is_maximizing) {
-    int score = evaluate_board(game);
+static int negamax(ai_t* ai, game_t* game, int player, const uint64_t* hashes,
+                   int ply, int depth, int alpha, int beta, int* best_move) {
+    ai->stats.nodes++;
+    if (ply > ai->stats.max_depth) {
+        ai->stats.max_depth = ply;
+    }
+
+    // Interruption demandée : on remonte sans rien mémoriser
+    if (ai->search_aborted) {
+        return SCORE_DRAW;
+    }
+    if ((ai->stats.nodes & (AI_STOP_CHECK_NODES - 1)) == 0 && should_stop(ai)) {
+        ai->search_aborted = 1;
+        return SCORE_DRAW;
+    }
+
+    const board_config_t* config = game->config;
+    const int symmetries = ai->use_symmetry ? config->symmetry_count : 1;
+    int transform;
+    const uint64_t key = canonical_key(hashes, symmetries, &transform);
+
+    // Consultation de la table de transposition
+    tt_data_t entry;
+    int hash_move = -1;
+    if (tt_probe(key, &entry)) {
+        ai->stats.tt_hits++;
+        if (entry.best_move >= 0) {
+            hash_move = config->symmetry_inverse[transform][entry.best_move];
+        }
+        if (best_move == NULL && entry.depth >= depth) {
+            int stored = score_from_tt(entry.score, ply);
+            if (entry.flag == TT_EXACT) return stored;
+            if (entry.flag == TT_LOWER) alpha = max(alpha, stored);
+            if (entry.flag == TT_UPPER) beta = min(beta, stored);
+            if (alpha >= beta) return stored;
+        }
+    }
+
+    // Cas de base : plateau plein sans vainqueur, ou horizon atteint
+    if (game->empty_count == 0) {
+        return SCORE_DRAW;
+    }
+    if (depth == 0) {
+        return evaluate_position(game, player);
+    }
+
+    const int opponent = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    const int alpha_orig = alpha;
+    int best = SCORE_LOSS - 1;
+    int best_index = -1;
+    uint64_t child[MAX_SYMMETRIES];
 
-    // Cas de base : position finale
-    if (score != SCORE_DRAW || count_cells(game->board, EMPTY) == 0) {
-        return score;
+    // Le meilleur coup d'une recherche précédente (variation principale
+    // de l'itération d'avant) est essayé avant même de générer les autres,
+    // qui suivent par priorité décroissante
+    if (hash_move >= 0 && get_cell(game, hash_move) != EMPTY) {
+        hash_move = -1;
     }
+    const int first = (hash_move >= 0) ? -1 : 0;
+    move_list_t moves;
+    moves.count = 0;
+
+    for (int m = first;; m++) {
+        if (m == 0) {
+            generate_moves(ai, game, player, ply, hash_move, &moves);
+        }
+        if (m >= moves.count) {
+            break;
+        }
+        const int i = (m < 0) ? hash_move : next_move(&moves, m);
+        int score;
+        if (make_move(game, i, player)) {
+            score = SCORE_WIN - (ply + 1);
+        } else {
+            child_hashes(config, hashes, symmetries, player, i, child);
+            score = -negamax(ai, game, opponent, child, ply + 1, depth - 1,
+                             -beta, -alpha, NULL);
+        }
+        unmake_move(game, i, player);
+
+        if (ai->search_aborted) {
+            return SCORE_DRAW;  // Score incomplet, à ne pas stocker
+        }
 
-    if (is_maximizing) {
-        // Tour de l'IA (maximise le score)
-        int best = SCORE_LOSS - 1;
-        for (int i = 0; i < N * N; i++) {
-            if (game->board[i] == EMPTY) {
-                game->board[i] = PLAYER_O;
-                best = max(best, minimax(game, depth + 1, 0));
-                game->board[i] = EMPTY;
+        if (score > best) {
+            best = score;
+            best_index = i;
+        }
+        alpha = max(alpha, score);
+        if (alpha >= beta) {
+            // Coupure : l'adversaire évitera cette position
+            ai->stats.cutoffs++;
+            if (m == first) {
+                ai->stats.first_cutoffs++;
             }
+            record_cutoff(ai, player, ply, depth, i, (m < 0) ? ORDER_HASH_MOVE : moves.scores[m]);
+            break;
         }
-        return best;
+    }
+
+    // Mémorisation du résultat dans le repère canonique
+    tt_store(key, score_to_tt(best, ply), config->symmetry_map[transform][best_index],
+             (best <= alpha_orig) ? TT_UPPER : (best >= beta) ? TT_LOWER : TT_EXACT,
+             depth);
+
+    if (best_move) {
+        *best_move = best_index;
+    }
+    return best;
+}
+
+/*********************************
+ * Recherche parallèle à la racine
+ *********************************/
+
+/**
+ * @brief Ajoute les statistiques d'un thread à celles de la recherche
+ */
+static void merge_stats(ai_stats_t* into, const ai_stats_t* from) {
+    into->nodes += from->nodes;
+    into->tt_hits += from->tt_hits;
+    into->cutoffs += from->cutoffs;
+    into->first_cutoffs += from->first_cutoffs;
+    into->max_depth = max(into->max_depth, from->max_depth);
+}
+
+/**
+ * @brief Recherche partagée entre les threads
+ *
+ * Le premier coup de la racine est cherché seul pour fixer une première
+ * borne ; les autres sont distribués un par un aux threads, qui partagent
+ * la table de transposition et la borne alpha courante.
+ */
+typedef struct {
+    const game_t* game;         /**< Position racine (chaque thread en fait une copie) */
+    const ai_t* ai;             /**< Configuration de l'IA à copier */
+    const uint64_t* hashes;     /**< Clés de la racine pour chaque symétrie */
+    const int* moves;           /**< Coups de la racine */
+    int move_count;
+    int depth;                  /**< Profondeur de la racine */
+    int thread_count;           /**< Threads participant à la recherche */
+
+    atomic_int next_move;       /**< Prochain coup à distribuer */
+    atomic_int alpha;           /**< Meilleur score connu à la racine */
+    atomic_int aborted;         /**< Un thread a été interrompu */
+
+    pthread_mutex_t best_mutex; /**< Protège best_score, best_move et stats */
+    int best_score;
+    int best_move;
+    ai_stats_t stats;           /**< Statistiques cumulées des threads */
+} root_search_t;
+
+/**
+ * @brief Threads auxiliaires réutilisés d'une recherche à l'autre
+ *
+ * Le thread appelant participe lui-même à la recherche : le pool contient
+ * au plus AI_MAX_THREADS - 1 threads, créés à la demande.
+ */
+static struct {
+    pthread_t threads[AI_MAX_THREADS];
+    unsigned long created_at[AI_MAX_THREADS];  /**< generation à la création du thread */
+    int thread_count;
+    pthread_mutex_t mutex;
+    pthread_cond_t work_cond;   /**< Une nouvelle recherche est publiée */
+    pthread_cond_t done_cond;   /**< Tous les threads ont terminé */
+    root_search_t* job;
+    unsigned long generation;   /**< Numéro de la recherche publiée */
+    int running;                /**< Threads n'ayant pas terminé la recherche */
+} pool = {
+    .mutex = PTHREAD_MUTEX_INITIALIZER,
+    .work_cond = PTHREAD_COND_INITIALIZER,
+    .done_cond = PTHREAD_COND_INITIALIZER
+};
+
+/**
+ * @brief Cherche un coup de la racine
+ * @return Score du coup du point de vue du joueur au trait
+ */
+static int search_root_move(ai_t* ai, game_t* game, const uint64_t* hashes,
+                            int move, int depth, int alpha, int beta) {
+    const board_config_t* config = game->config;
+    const int symmetries = ai->use_symmetry ? config->symmetry_count : 1;
+    const int player = game->player;
+    const int opponent = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    uint64_t child[MAX_SYMMETRIES];
+    int score;
+
+    if (make_move(game, move, player)) {
+        score = SCORE_WIN - 1;
     } else {
-        // Tour du joueur (minimise le score)
-        int best = SCORE_WIN + 1;
-        for (int i = 0; i < N * N; i++) {
-            if (game->board[i] == EMPTY) {
-                game->board[i] = PLAYER_X;
-                best = min(best, minimax(game, depth + 1, 1));
-                game->board[i] = EMPTY;
+        child_hashes(config, hashes, symmetries, player, move, child);
+        score = -negamax(ai, game, opponent, child, 1, depth - 1, -beta, -alpha, NULL);
+    }
+    unmake_move(game, move, player);
+
+    return score;
+}
+
+/**
+ * @brief Boucle d'un thread : prend des coups de la racine jusqu'à épuisement
+ */
+static void root_search_worker(root_search_t* job) {
+    game_t game = *job->game;
+    ai_t ai = *job->ai;
+    int index;
+
+    ai.stats = (ai_stats_t){0};
+    ai.search_aborted = 0;
+
+    while ((index = atomic_fetch_add(&job->next_move, 1)) < job->move_count) {
+        const int move = job->moves[index];
+        const int alpha = atomic_load(&job->alpha);
+        const int score = search_root_move(&ai, &game, job->hashes, move, job->depth,
+                                           alpha, SCORE_WIN + 1);
+        if (ai.search_aborted) {
+            atomic_store(&job->aborted, 1);
+            break;
+        }
+
+        // Un score qui ne dépasse pas alpha n'est qu'une borne supérieure
+        if (score > alpha) {
+            pthread_mutex_lock(&job->best_mutex);
+            if (score > job->best_score) {
+                job->best_score = score;
+                job->best_move = move;
+                atomic_store(&job->alpha, score);
             }
+            pthread_mutex_unlock(&job->best_mutex);
         }
-        return best;
     }
+
+    pthread_mutex_lock(&job->best_mutex);
+    merge_stats(&job->stats, &ai.stats);
+    pthread_mutex_unlock(&job->best_mutex);
+}
+
+/**
+ * @brief Corps des threads du pool
+ */
+static void* pool_thread_main(void* arg) {
+    const int index = (int)(intptr_t)arg;
+
+    pthread_mutex_lock(&pool.mutex);
+    unsigned long seen = pool.created_at[index];
+    for (;;) {
+        while (pool.generation == seen) {
+            pthread_cond_wait(&pool.work_cond, &pool.mutex);
+        }
+        seen = pool.generation;
+        root_search_t* job = pool.job;
+        pthread_mutex_unlock(&pool.mutex);
+
+        // Le thread appelant a l'indice 0
+        if (index + 1 < job->thread_count) {
+            root_search_worker(job);
+        }
+
+        pthread_mutex_lock(&pool.mutex);
+        if (--pool.running == 0) {
+            pthread_cond_signal(&pool.done_cond);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Crée les threads auxiliaires manquants
+ * @return Nombre de threads disponibles, thread appelant compris
+ */
+static int ensure_pool(int thread_count) {
+    pthread_mutex_lock(&pool.mutex);
+    while (pool.thread_count < thread_count - 1) {
+        pool.created_at[pool.thread_count] = pool.generation;
+        if (pthread_create(&pool.threads[pool.thread_count], NULL, pool_thread_main,
+                           (void*)(intptr_t)pool.thread_count) != 0) {
+            break;
+        }
+        pool.thread_count++;
+    }
+    const int available = pool.thread_count + 1;
+    pthread_mutex_unlock(&pool.mutex);
+
+    return (available < thread_count) ? available : thread_count;
+}
+
+/**
+ * @brief Recherche de la racine répartie sur ai->thread_count threads
+ *
+ * @param ai Configuration de l'IA
+ * @param game Position racine
+ * @param hashes Clés de la racine pour chaque symétrie
+ * @param moves Coups de la racine
+ * @param move_count Nombre de coups (au moins 2)
+ * @param depth Profondeur de la recherche
+ * @param best_move Reçoit le meilleur coup
+ * @return Score du meilleur coup
+ */
+static int parallel_root_search(ai_t* ai, game_t* game, const uint64_t* hashes,
+                                const int* moves, int move_count, int depth,
+                                int* best_move) {
+    root_search_t job = {
+        .game = game,
+        .ai = ai,
+        .hashes = hashes,
+        .moves = moves,
+        .move_count = move_count,
+        .depth = depth,
+        .best_mutex = PTHREAD_MUTEX_INITIALIZER,
+        .best_move = moves[0]
+    };
+
+    // Premier coup seul : il fixe la borne que les autres threads partagent
+    job.best_score = search_root_move(ai, game, hashes, moves[0], depth,
+                                      SCORE_LOSS - 1, SCORE_WIN + 1);
+    if (ai->search_aborted || job.best_score >= SCORE_WIN - 1) {
+        *best_move = moves[0];
+        return job.best_score;
+    }
+
+    atomic_init(&job.next_move, 1);
+    atomic_init(&job.alpha, job.best_score);
+    atomic_init(&job.aborted, 0);
+    job.thread_count = ensure_pool(ai->thread_count);
+
+    // Publication de la recherche aux threads du pool
+    pthread_mutex_lock(&pool.mutex);
+    pool.job = &job;
+    pool.running = pool.thread_count;
+    pool.generation++;
+    pthread_cond_broadcast(&pool.work_cond);
+    pthread_mutex_unlock(&pool.mutex);
+
+    root_search_worker(&job);
+
+    pthread_mutex_lock(&pool.mutex);
+    while (pool.running > 0) {
+        pthread_cond_wait(&pool.done_cond, &pool.mutex);
+    }
+    pool.job = NULL;
+    pthread_mutex_unlock(&pool.mutex);
+
+    merge_stats(&ai->stats, &job.stats);
+    ai->search_aborted = atomic_load(&job.aborted);
+    pthread_mutex_destroy(&job.best_mutex);
+
+    *best_move = job.best_move;
+    return job.best_score;
+}
+
+/**
+ * @brief Profondeur maximale de la recherche du niveau difficile
+ *
+ * Jusqu'en fin de partie, sauf sur les grands plateaux sans limite de
+ * temps, bornés à AI_LARGE_BOARD_DEPTH.
+ */
+static int search_depth_limit(const game_t* game, const ai_t* ai) {
+    return (ai->time_limit_ms > 0 || game->config->cell_count <= AI_EXACT_SEARCH_CELLS)
+         ? game->empty_count
+         : min(AI_LARGE_BOARD_DEPTH, game->empty_count);
+}
+
+/**
+ * @brief Vérifie si un score est une fin de partie à portée d'une recherche
+ *
+ * Une victoire ou une défaite forcée à au plus depth demi-coups ne change
+ * plus en cherchant plus loin. Un mat plus lointain peut venir de la table
+ * (recherche antérieure plus profonde) et cacher un mat plus court que
+ * seule une recherche plus profonde trouvera.
+ */
+static int is_proven_score(int score, int depth) {
+    return (score > SCORE_WIN_THRESHOLD || score < -SCORE_WIN_THRESHOLD) &&
+           SCORE_WIN - abs(score) <= depth;
 }
 
 /**
  * @brief Trouve le meilleur coup possible (mode difficile)
  * 
- * Utilise l'algorithme Minimax pour évaluer toutes les possibilités
- * et choisir le meilleur coup.
+ * Sur le plateau 3x3, lit le coup dans la table précalculée (ai_table.h).
+ * Sinon, réutilise le résultat d'une recherche précédente sur une position
+ * équivalente par symétrie, ramené dans le repère courant par la
+ * transformation inverse. À défaut, lance une recherche alpha-beta par
+ * approfondissement itératif (profondeur 1, 2, ...) depuis la position
+ * courante, jusqu'à la fin de partie ou jusqu'à ai->time_limit_ms ; le
+ * coup renvoyé est celui de la dernière profondeur terminée. Sans limite
+ * de temps, les grands plateaux s'arrêtent à AI_LARGE_BOARD_DEPTH.
+ * Avec plusieurs threads, les coups de la racine sont répartis entre eux.
  *
  * @param game État du jeu
+ * @param ai Configuration de l'IA
  * @return Position du meilleur coup
  */
-static int find_best_move(game_t* game) {
-    int best_value = SCORE_LOSS - 1;
+static int find_best_move(game_t* game, ai_t* ai) {
+    const board_config_t* config = game->config;
     int best_move = -1;
 
-    // Évalue chaque coup possible
-    for (int i = 0; i < N * N; i++) {
-        if (game->board[i] == EMPTY) {
-            game->board[i] = PLAYER_O;
-            int move_value = minimax(game, 0, 0);
-            game->board[i] = EMPTY;
+#ifndef AI_NO_LOOKUP_TABLE
+    if (config->kind == BOARD_KIND_3X3) {
+        const int index = ai_table_base3[game->boards[PLAYER_INDEX(PLAYER_X)].words[0]]
+                        + 2 * ai_table_base3[game->boards[PLAYER_INDEX(PLAYER_O)].words[0]];
+        best_move = ai_table_moves[PLAYER_INDEX(game->player)][index];
+        if (best_move >= 0) {
+            return best_move;
+        }
+    }
+#endif
+
+    const int max_depth = search_depth_limit(game, ai);
+    const int symmetries = ai->use_symmetry ? config->symmetry_count : 1;
+    uint64_t hashes[MAX_SYMMETRIES] = {0};
+    int transform;
+    compute_hashes(game, game->player, symmetries, hashes);
 
-            if (move_value > best_value) {
-                best_move = i;
-                best_value = move_value;
+    // Position (ou l'une de ses symétriques) déjà résolue
+    const uint64_t key = canonical_key(hashes, symmetries, &transform);
+    tt_data_t entry;
+    if (tt_probe(key, &entry) && entry.flag == TT_EXACT && entry.depth >= max_depth &&
+        entry.best_move >= 0) {
+        best_move = config->symmetry_inverse[transform][entry.best_move];
+        if (get_cell(game, best_move) == EMPTY) {
+            ai->stats.depth = entry.depth;
+            return best_move;
+        }
+    }
+
+    clear_move_ordering(ai);
+
+    // Coups de la racine dans l'ordre de priorité
+    move_list_t list;
+    int moves[MAX_CELLS];
+    generate_moves(ai, game, game->player, 0, -1, &list);
+    const int move_count = list.count;
+    for (int m = 0; m < move_count; m++) {
+        moves[m] = next_move(&list, m);
+    }
+    const int parallel = ai->thread_count > 1 && move_count >= AI_PARALLEL_MIN_MOVES;
+
+    // Approfondissement itératif : chaque itération terminée fournit un coup
+    ai->deadline_ms = (ai->time_limit_ms > 0) ? now_ms() + ai->time_limit_ms : 0;
+    for (int depth = 1; depth <= max_depth; depth++) {
+        int move = -1;
+        int score;
+
+        if (parallel) {
+            // Variation principale de l'itération précédente en tête
+            for (int m = 1; m < move_count && best_move >= 0; m++) {
+                if (moves[m] == best_move) {
+                    moves[m] = moves[0];
+                    moves[0] = best_move;
+                }
+            }
+            score = parallel_root_search(ai, game, hashes, moves, move_count, depth, &move);
+            if (!ai->search_aborted) {
+                tt_store(key, score_to_tt(score, 0), config->symmetry_map[transform][move],
+                         TT_EXACT, depth);
             }
+        } else {
+            score = negamax(ai, game, game->player, hashes, 0, depth,
+                            SCORE_LOSS - 1, SCORE_WIN + 1, &move);
+        }
+
+        if (ai->search_aborted) {
+            break;  // Itération incomplète : on garde le coup de la précédente
+        }
+
+        best_move = move;
+        ai->stats.depth = depth;
+
+        // Victoire ou défaite forcée à portée de cette itération
+        if (is_proven_score(score, depth)) {
+            break;
         }
     }
+    ai->deadline_ms = 0;
+
+    // Seule une interruption extérieure invalide le résultat, pas l'échéance
+    if (ai->search_aborted && !(ai->stop_flag && atomic_load(ai->stop_flag))) {
+        ai->search_aborted = 0;
+    }
+    if (best_move < 0) {
+        best_move = moves[0];
+    }
 
     return best_move;
 }
 
+/*********************************
+ * Niveau moyen : menaces
+ *********************************/
+
+/**
+ * @brief Case vide d'une ligne autre que except
+ * @return Index de la case, -1 s'il n'y en a pas
+ */
+static int line_gap(const game_t* game, int line, int except) {
+    const board_config_t* config = game->config;
+    const int step = config->direction_steps[config->line_directions[line]];
+    int cell = config->line_starts[line];
+
+    for (int i = 0; i < config->win_length; i++, cell += step) {
+        if (cell != except && get_cell(game, cell) == EMPTY) {
+            return cell;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Nombre de menaces de victoire créées en jouant cell
+ *
+ * Une menace est une ligne sans pion adverse qui, après le coup, ne
+ * manque plus que d'une case. Deux lignes manquant de la même case ne
+ * forment qu'une menace : l'adversaire les pare d'un seul coup. Le
+ * décompte s'arrête à 2, seuil d'une fourchette.
+ *
+ * @param game État du jeu
+ * @param cell Case vide à tester
+ * @param player Joueur qui jouerait en cell
+ * @return 0, 1 ou 2 (au moins deux menaces)
+ */
+static int count_threats(const game_t* game, int cell, int player) {
+    const board_config_t* config = game->config;
+    const int opponent = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    const int16_t* lines = config->cell_lines[cell];
+    const uint8_t* own = game->line_counts[PLAYER_INDEX(player)];
+    const uint8_t* other = game->line_counts[PLAYER_INDEX(opponent)];
+    int first_gap = -1;
+
+    for (int i = 0; i < config->cell_line_count[cell]; i++) {
+        const int line = lines[i];
+        if (own[line] != config->win_length - 2 || other[line] != 0) {
+            continue;
+        }
+
+        const int gap = line_gap(game, line, cell);
+        if (first_gap < 0) {
+            first_gap = gap;
+        } else if (gap != first_gap) {
+            return 2;
+        }
+    }
+    return (first_gap < 0) ? 0 : 1;
+}
+
 /**
  * @brief Trouve un coup pour le niveau moyen
  * 
- * Stratégie :
- * 1. Cherche une victoire immédiate
+ * Stratégie, par ordre de priorité :
+ * 1. Gagne immédiatement
  * 2. Bloque une victoire adverse imminente
- * 3. Joue aléatoirement
+ * 3. Crée une fourchette (deux menaces que l'adversaire ne peut pas
+ *    parer d'un seul coup)
+ * 4. Occupe la case où l'adversaire créerait une fourchette
+ * 5. Joue aléatoirement
+ *
+ * Toutes les cases sont examinées en une passe à partir des compteurs de
+ * lignes : chaque test ne coûte que le nombre de lignes passant par la
+ * case, ce qui garde le niveau instantané sur les grands plateaux.
  *
  * @param game État du jeu
+ * @param ai IA, pour le coup aléatoire
  * @return Position choisie
  */
-static int find_medium_move(game_t* game) {
-    // 1. Recherche d'une victoire immédiate
-    for (int i = 0; i < N * N; i++) {
-        if (is_winning_move(game, i, PLAYER_O)) {
+static int find_medium_move(const game_t* game, ai_t* ai) {
+    const int player = game->player;
+    const int opponent = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    int block = -1;
+    int fork = -1;
+    int fork_block = -1;
+
+    bitboard_t empty = empty_cells(game);
+    int i;
+    while ((i = bitboard_pop_lowest(&empty)) >= 0) {
+        // 1. Victoire immédiate
+        if (completes_line(game, i, player)) {
             return i;
         }
+
+        // 2. à 4. : premier candidat de chaque catégorie
+        if (block < 0 && completes_line(game, i, opponent)) {
+            block = i;
+        } else if (block < 0 && fork < 0 && count_threats(game, i, player) >= 2) {
+            fork = i;
+        } else if (block < 0 && fork < 0 && fork_block < 0 &&
+                   count_threats(game, i, opponent) >= 2) {
+            fork_block = i;
+        }
     }
 
-    // 2. Blocage d'une victoire adverse
-    for (int i = 0; i < N * N; i++) {
-        if (is_winning_move(game, i, PLAYER_X)) {
-            return i;
+    if (block >= 0) return block;
+    if (fork >= 0) return fork;
+    if (fork_block >= 0) return fork_block;
+
+    // 5. Coup aléatoire
+    return find_random_empty_cell(game, ai);
+}
+
+/*********************************
+ * Réflexion pendant le tour adverse
+ *********************************/
+
+/** @brief Nombre maximal de réponses adverses préparées par ai_ponder() */
+#define AI_PONDER_CACHE_SIZE 64
+
+/** @brief Coup préparé pour une position */
+typedef struct {
+    uint64_t key;                  /**< Clé de Zobrist de la position (sans symétrie) */
+    const board_config_t* config;  /**< Plateau de la position */
+    AIDifficulty difficulty;       /**< Niveau qui a préparé le coup */
+    int reply;                     /**< Réponse adverse menant à la position */
+    int move;                      /**< Coup de la dernière profondeur terminée, -1 si aucun */
+    int depth;                     /**< Dernière profondeur terminée */
+    int complete;                  /**< Même coup qu'une recherche complète (voir ponder_lookup) */
+} ponder_entry_t;
+
+/**
+ * @brief Coups préparés pendant le dernier tour adverse
+ *
+ * Remplie par ai_ponder() et lue par ai_get_move(), toutes deux appelées
+ * par le même thread de recherche : chaque thread a sa propre table.
+ */
+static _Thread_local ponder_entry_t ponder_cache[AI_PONDER_CACHE_SIZE];
+static _Thread_local int ponder_count = 0;
+
+/**
+ * @brief Clé identifiant exactement une position (plateau et trait)
+ */
+static uint64_t position_key(const game_t* game) {
+    uint64_t key;
+    compute_hashes(game, game->player, 1, &key);
+    return key;
+}
+
+/**
+ * @brief Cherche le coup préparé pour une position
+ *
+ * Un coup n'est servi que s'il vaut celui d'une recherche normale sans
+ * limite de temps : recherche terminée (fin de partie prouvée ou
+ * profondeur maximale) ou, sur les grands plateaux, profondeur d'au moins
+ * AI_LARGE_BOARD_DEPTH. Sinon, la recherche normale repart, accélérée par
+ * la table de transposition remplie pendant la réflexion.
+ *
+ * @return Case du coup, -1 si la position n'a pas été préparée
+ */
+static int ponder_lookup(const game_t* game, ai_t* ai) {
+    if (ponder_count == 0) {
+        return -1;
+    }
+
+    const uint64_t key = position_key(game);
+    for (int e = 0; e < ponder_count; e++) {
+        const ponder_entry_t* entry = &ponder_cache[e];
+        if (entry->key != key || entry->config != game->config ||
+            entry->difficulty != ai->difficulty || entry->move < 0 ||
+            get_cell(game, entry->move) != EMPTY) {
+            continue;
+        }
+        const int deep_enough = game->config->cell_count > AI_EXACT_SEARCH_CELLS &&
+                                entry->depth >= AI_LARGE_BOARD_DEPTH;
+        if (entry->complete || deep_enough) {
+            ai->stats.depth = entry->depth;
+            return entry->move;
         }
     }
+    return -1;
+}
 
-    // 3. Coup aléatoire
-    return find_random_empty_cell(game);
+/**
+ * @brief Coup de l'IA pour les niveaux qui cherchent longtemps
+ */
+static int search_move(game_t* game, ai_t* ai) {
+    return (ai->difficulty == EXPERT) ? mcts_get_move(game, ai) : find_best_move(game, ai);
 }
 
 /**
- * @brief Détermine le prochain coup selon la difficulté
- * 
- * @param game État du jeu
- * @param ai Configuration de l'IA
- * @return Position choisie
+ * @brief Choisit le coup selon le niveau de difficulté
  */
-static int ai_get_move(game_t* game, const ai_t* ai) {
+static int choose_move(game_t* game, ai_t* ai) {
     switch (ai->difficulty) {
         case EASY:
-            return find_random_empty_cell(game);
+            return find_random_empty_cell(game, ai);
             
         case MEDIUM:
-            return find_medium_move(game);
+            return find_medium_move(game, ai);
             
         case HARD:
-            return find_best_move(game);
+        case EXPERT: {
+            // Réponse préparée pendant le tour adverse
+            const int move = ponder_lookup(game, ai);
+            if (move >= 0) {
+                ai->stats.ponder_hit = 1;
+                return move;
+            }
+            return search_move(game, ai);
+        }
             
         default:
-            return find_random_empty_cell(game);
+            return find_random_empty_cell(game, ai);
     }
 }
 
@@ -211,17 +1301,190 @@ static int ai_get_move(game_t* game, const ai_t* ai) {
  * Implémentation des fonctions publiques
  *********************************/
 
+int ai_get_move(game_t* game, ai_t* ai) {
+    ai->search_aborted = 0;
+    ai->stats = (ai_stats_t){0};
+
+    const double start = now_ms();
+    const int move = choose_move(game, ai);
+    ai->stats.wall_time_ms = now_ms() - start;
+    ai->stats.nodes_per_second = (ai->stats.wall_time_ms > 0)
+                               ? ai->stats.nodes * 1e3 / ai->stats.wall_time_ms
+                               : 0;
+
+    return move;
+}
+
+void ai_ponder(game_t* game, ai_t* ai) {
+    const int player = game->player;
+    const int opponent = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+
+    ponder_count = 0;
+    ai->search_aborted = 0;
+    ai->stats = (ai_stats_t){0};
+    if (ai->difficulty == EXPERT) {
+        mcts_ponder(game, ai);  // Arbre repris au coup du joueur
+        return;
+    }
+    if (ai->difficulty != HARD) {
+        return;
+    }
+#ifndef AI_NO_LOOKUP_TABLE
+    if (game->config->kind == BOARD_KIND_3X3) {
+        return;  // Réponses lues dans la table : rien à préparer
+    }
+#endif
+
+    // Réponses adverses dans l'ordre du tri de la recherche : victoires,
+    // parades, puis cases les plus centrales (voisines des pions sur les
+    // grands plateaux)
+    move_list_t replies;
+    clear_move_ordering(ai);
+    generate_moves(ai, game, player, 0, -1, &replies);
+
+    for (int m = 0; m < replies.count && ponder_count < AI_PONDER_CACHE_SIZE; m++) {
+        const int reply = next_move(&replies, m);
+
+        // Rien à préparer si la réponse termine la partie
+        if (!make_move(game, reply, player) && game->empty_count > 0) {
+            game->player = opponent;
+            ponder_cache[ponder_count++] = (ponder_entry_t){
+                .key = position_key(game),
+                .config = game->config,
+                .difficulty = ai->difficulty,
+                .reply = reply,
+                .move = -1
+            };
+            game->player = player;
+        }
+        unmake_move(game, reply, player);
+    }
+
+    // Toutes les réponses sont approfondies ensemble, une profondeur à la
+    // fois : quand le joueur joue, chacune a reçu la même part de sa
+    // réflexion. Sans demande d'interruption possible, la réflexion dure
+    // au plus le temps d'un coup.
+    const int symmetries = ai->use_symmetry ? game->config->symmetry_count : 1;
+    ai->deadline_ms = (!ai->stop_flag && ai->time_limit_ms > 0) ? now_ms() + ai->time_limit_ms : 0;
+    for (int depth = 1, pending = ponder_count; pending > 0 && !ai->search_aborted; depth++) {
+        pending = 0;
+        for (int e = 0; e < ponder_count; e++) {
+            ponder_entry_t* entry = &ponder_cache[e];
+            if (entry->complete) {
+                continue;
+            }
+
+            uint64_t hashes[MAX_SYMMETRIES];
+            int move = -1;
+            make_move(game, entry->reply, player);
+            game->player = opponent;
+            compute_hashes(game, opponent, symmetries, hashes);
+            const int score = negamax(ai, game, opponent, hashes, 0, depth,
+                                      SCORE_LOSS - 1, SCORE_WIN + 1, &move);
+            const int limit = search_depth_limit(game, ai);
+            game->player = player;
+            unmake_move(game, entry->reply, player);
+
+            if (ai->search_aborted) {
+                break;  // Profondeur incomplète : l'entrée garde la précédente
+            }
+            entry->move = move;
+            entry->depth = depth;
+            entry->complete = depth >= limit || is_proven_score(score, depth);
+            pending += !entry->complete;
+        }
+        if (!ai->search_aborted) {
+            ai->stats.depth = depth;
+        }
+    }
+    ai->deadline_ms = 0;
+}
+
+/**
+ * @brief Nom d'un niveau dans les relevés de statistiques
+ */
+static const char* difficulty_name(AIDifficulty difficulty) {
+    switch (difficulty) {
+        case EASY: return "easy";
+        case MEDIUM: return "medium";
+        case HARD: return "hard";
+        case EXPERT: return "expert";
+        default: return "unknown";
+    }
+}
+
+void ai_stats_write_header(FILE* out, AIStatsFormat format) {
+    if (format == AI_STATS_CSV) {
+        fprintf(out, "difficulty,width,height,win_length,stones,nodes,tt_hits,cutoffs,"
+                     "first_cutoffs,depth,max_depth,ponder_hit,tree_full_playouts,reused_playouts,"
+                     "wall_time_ms,nodes_per_second\n");
+        fflush(out);
+    }
+}
+
+void ai_stats_write(FILE* out, AIStatsFormat format, const game_t* game, const ai_t* ai) {
+    const board_config_t* config = game->config;
+    const ai_stats_t* stats = &ai->stats;
+    const int stones = config->cell_count - game->empty_count;
+
+    if (format == AI_STATS_JSON) {
+        fprintf(out, "{\"difficulty\":\"%s\",\"width\":%d,\"height\":%d,\"win_length\":%d,"
+                     "\"stones\":%d,\"nodes\":%lu,\"tt_hits\":%lu,\"cutoffs\":%lu,"
+                     "\"first_cutoffs\":%lu,\"depth\":%d,\"max_depth\":%d,\"ponder_hit\":%d,"
+                     "\"tree_full_playouts\":%lu,\"reused_playouts\":%lu,\"wall_time_ms\":%.3f,"
+                     "\"nodes_per_second\":%.0f}\n",
+                difficulty_name(ai->difficulty), config->width, config->height,
+                config->win_length, stones, stats->nodes, stats->tt_hits, stats->cutoffs,
+                stats->first_cutoffs, stats->depth, stats->max_depth, stats->ponder_hit,
+                stats->tree_full_playouts, stats->reused_playouts,
+                stats->wall_time_ms, stats->nodes_per_second);
+    } else {
+        fprintf(out, "%s,%d,%d,%d,%d,%lu,%lu,%lu,%lu,%d,%d,%d,%lu,%lu,%.3f,%.0f\n",
+                difficulty_name(ai->difficulty), config->width, config->height,
+                config->win_length, stones, stats->nodes, stats->tt_hits, stats->cutoffs,
+                stats->first_cutoffs, stats->depth, stats->max_depth, stats->ponder_hit,
+                stats->tree_full_playouts, stats->reused_playouts,
+                stats->wall_time_ms, stats->nodes_per_second);
+    }
+    fflush(out);
+}
+
+int ai_default_thread_count(void) {
+    const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cores < 1) {
+        return 1;
+    }
+    return (cores > AI_MAX_THREADS) ? AI_MAX_THREADS : (int)cores;
+}
+
 void init_ai(ai_t* ai, AIDifficulty difficulty) {
     ai->difficulty = difficulty;
-    srand((unsigned int)time(NULL));
+    ai->stats = (ai_stats_t){0};
+    ai->use_symmetry = 1;
+    ai->stop_flag = NULL;
+    ai->search_aborted = 0;
+    ai->thread_count = ai_default_thread_count();
+    ai->time_budget_ms = AI_DEFAULT_TIME_BUDGET_MS;
+    ai->time_limit_ms = AI_DEFAULT_TIME_LIMIT_MS;
+    ai->deadline_ms = 0;
+    ai->playout_budget = 0;
+    ai->use_move_ordering = 1;
+    clear_move_ordering(ai);
+    rng_seed(&ai->rng, AI_DEFAULT_SEED);
+    init_search_tables();
+    mcts_reset();
+}
+
+void ai_seed(ai_t* ai, uint64_t seed) {
+    rng_seed(&ai->rng, seed);
 }
 
 void ai_make_move(game_t* game, ai_t* ai) {
     int move = ai_get_move(game, ai);
     
     if (move != -1) {
-        int row = move / N;
-        int col = move % N;
+        int row = move / game->config->width;
+        int col = move % game->config->width;
         click_on_cell(game, row, col);
     }
 }
\ No newline at end of file
@@ -4,14 +4,26 @@
  *
  * Ce module implémente différents niveaux d'IA :
  * - Facile : Stratégie aléatoire
- * - Moyen : Mélange de stratégie basique et aléatoire
- * - Difficile : Algorithme Minimax
+ * - Moyen : Victoires, parades et fourchettes lues sur les compteurs de
+ *   lignes, coup aléatoire sinon
+ * - Difficile : Algorithme Minimax avec élagage alpha-beta
+ *   et table de transposition (hachage de Zobrist) indexée par la forme
+ *   canonique de la position parmi ses 8 symétriques ; table de coups
+ *   parfaits générée à la compilation pour le plateau 3x3 ; coups de la
+ *   racine répartis entre plusieurs threads ; coups triés (victoires,
+ *   parades, coups meurtriers, historique) et limités au voisinage des
+ *   pions sur les grands plateaux
+ * - Expert : Recherche arborescente Monte-Carlo (UCT) à budget de temps,
+ *   pour les grands plateaux (voir mcts.h)
  */
 
 #ifndef AI_H_
 #define AI_H_
 
+#include <stdatomic.h>
+#include <stdio.h>
 #include "./game.h"
+#include "./rng.h"
 
 /**
  * @brief Niveaux de difficulté de l'IA
@@ -21,24 +33,100 @@
  */
 typedef enum {
     EASY = 11,    /**< Coups aléatoires uniquement */
-    MEDIUM = 22,  /**< Stratégie simple + aléatoire */
-    HARD = 33     /**< Algorithme Minimax (optimal) */
+    MEDIUM = 22,  /**< Menaces (victoire, parade, fourchette) + aléatoire */
+    HARD = 33,    /**< Algorithme Minimax (optimal) */
+    EXPERT = 44   /**< Recherche Monte-Carlo (UCT), pour les grands plateaux */
 } AIDifficulty;
 
 /**
  * @brief Scores utilisés par l'algorithme Minimax
+ *
+ * Une victoire obtenue en d demi-coups vaut SCORE_WIN - d (et une défaite
+ * SCORE_LOSS + d) pour privilégier les victoires les plus rapides.
  */
 typedef enum {
-    SCORE_LOSS = -10,  /**< Score d'une défaite */
-    SCORE_DRAW = 0,    /**< Score d'une égalité */
-    SCORE_WIN = 10     /**< Score d'une victoire */
+    SCORE_LOSS = -1000,  /**< Score d'une défaite immédiate */
+    SCORE_DRAW = 0,      /**< Score d'une égalité */
+    SCORE_WIN = 1000     /**< Score d'une victoire immédiate */
 } AIScore;
 
+/** @brief Nombre maximal de threads de recherche */
+#define AI_MAX_THREADS 64
+
+/** @brief Temps de réflexion par défaut du niveau expert (ms) */
+#define AI_DEFAULT_TIME_BUDGET_MS 1000
+
+/** @brief Temps maximal par coup par défaut du niveau difficile (ms) */
+#define AI_DEFAULT_TIME_LIMIT_MS 2000
+
+/** @brief Graine du générateur après init_ai() (voir ai_seed) */
+#define AI_DEFAULT_SEED 0x5EEDull
+
+/**
+ * @brief Statistiques d'un appel à ai_get_move()
+ *
+ * Les compteurs de recherche ne concernent que les niveaux difficile
+ * (nœuds alpha-beta) et expert (simulations Monte-Carlo).
+ */
+typedef struct {
+    unsigned long nodes;         /**< Nœuds visités (simulations pour le niveau expert) */
+    unsigned long tt_hits;       /**< Positions trouvées dans la table de transposition */
+    unsigned long cutoffs;       /**< Coupures alpha-beta */
+    unsigned long first_cutoffs; /**< Coupures obtenues dès le premier coup essayé */
+    int depth;                   /**< Dernière profondeur entièrement explorée (difficile) */
+    int max_depth;               /**< Plus grande distance à la racine atteinte */
+    int ponder_hit;              /**< Coup préparé pendant le tour adverse (voir ai_ponder) */
+    unsigned long tree_full_playouts; /**< Simulations sans développement, arbre plein (expert) */
+    unsigned long reused_playouts; /**< Simulations héritées de l'arbre précédent (expert) */
+    double wall_time_ms;         /**< Durée de l'appel */
+    double nodes_per_second;     /**< Débit de la recherche */
+} ai_stats_t;
+
+/** @brief Formats des relevés de statistiques */
+typedef enum {
+    AI_STATS_CSV = 0,   /**< Une ligne CSV par coup, après un en-tête */
+    AI_STATS_JSON = 1   /**< Un objet JSON par ligne et par coup */
+} AIStatsFormat;
+
 /**
  * @brief Configuration de l'IA
  */
 typedef struct {
     AIDifficulty difficulty;  /**< Niveau de difficulté choisi */
+    ai_stats_t stats;         /**< Statistiques du dernier appel à ai_get_move() */
+    int use_symmetry;         /**< Fusionne les positions symétriques (1 par défaut) */
+
+    /**
+     * @brief Demande d'interruption de la recherche (NULL : jamais)
+     * Consulté régulièrement pendant la recherche ; une valeur non nulle
+     * l'abandonne et met search_aborted à 1.
+     */
+    const atomic_int* stop_flag;
+    int search_aborted;       /**< La dernière recherche a été interrompue */
+
+    int thread_count;         /**< Threads de recherche (1 : recherche séquentielle) */
+
+    int time_budget_ms;       /**< Temps de réflexion du niveau expert */
+    unsigned long playout_budget; /**< Simulations maximales du niveau expert (0 : pas de limite) */
+
+    int time_limit_ms;        /**< Temps maximal par coup du niveau difficile (0 : pas de limite) */
+    double deadline_ms;       /**< Usage interne : échéance de la recherche en cours */
+
+    int use_move_ordering;    /**< Trie les coups du niveau difficile (1 par défaut) */
+
+    /**
+     * @brief Générateur des coups aléatoires (facile, moyen) et des
+     * simulations (expert), propre à cette IA
+     */
+    rng_t rng;
+
+    /**
+     * @brief Usage interne : coups ayant provoqué une coupure
+     * killer_moves[ply] garde les deux derniers à ce demi-coup ;
+     * history[p][i] cumule depth² à chaque coupure de la case i par p.
+     */
+    int16_t killer_moves[MAX_CELLS][2];
+    int history[2][MAX_CELLS];
 } ai_t;
 
 /*********************************
@@ -48,21 +136,112 @@ typedef struct {
 /**
  * @brief Initialise l'IA avec un niveau de difficulté
  * 
- * Configure l'IA et initialise le générateur de nombres aléatoires
- * pour les stratégies qui en ont besoin.
+ * Configure l'IA et vide la table de transposition. Le générateur de
+ * l'IA part toujours de la graine AI_DEFAULT_SEED : deux IA initialisées
+ * de la même façon jouent les mêmes coups, sauf ai_seed(). La recherche
+ * utilise par défaut un thread par cœur.
  *
  * @param ai Pointeur vers la structure de l'IA
  * @param difficulty Niveau de difficulté souhaité
  */
 void init_ai(ai_t* ai, AIDifficulty difficulty);
 
+/**
+ * @brief Change la graine du générateur de l'IA
+ *
+ * Avec la même graine, les niveaux facile et moyen rejouent exactement
+ * les mêmes coups ; le niveau expert aussi s'il est limité en simulations
+ * (playout_budget) plutôt qu'en temps.
+ *
+ * @param ai IA initialisée
+ * @param seed Graine quelconque
+ */
+void ai_seed(ai_t* ai, uint64_t seed);
+
+/**
+ * @brief Nombre de threads de recherche par défaut
+ * @return Nombre de cœurs disponibles, borné par AI_MAX_THREADS
+ */
+int ai_default_thread_count(void);
+
+/**
+ * @brief Détermine le prochain coup de l'IA sans le jouer
+ *
+ * Le plateau peut être modifié pendant la recherche mais il est
+ * restauré avant le retour. Une seule recherche parallèle
+ * (thread_count > 1) peut être en cours à la fois : les threads de
+ * recherche sont partagés. Des recherches séquentielles peuvent tourner
+ * en même temps sur des threads différents ; la table de transposition,
+ * sans verrou, est alors partagée entre elles. init_ai() ne doit pas être
+ * appelée pendant une recherche.
+ *
+ * Si la recherche est interrompue par ai->stop_flag, ai->search_aborted
+ * vaut 1 et le coup renvoyé ne doit pas être joué. Une position préparée
+ * par ai_ponder() est servie immédiatement (stats.ponder_hit vaut 1) si
+ * sa recherche est terminée ou, sur les grands plateaux, aussi profonde
+ * que celle du niveau difficile sans limite de temps.
+ *
+ * @param game Pointeur vers l'état du jeu
+ * @param ai Pointeur vers la configuration de l'IA
+ * @return Index de la case choisie, -1 si aucune case n'est libre
+ */
+int ai_get_move(game_t* game, ai_t* ai);
+
+/**
+ * @brief Prépare les réponses de l'IA pendant le tour adverse
+ *
+ * Au niveau difficile, prend les réponses les plus probables du joueur au
+ * trait (64 au plus, dans l'ordre du tri des coups de la recherche) et
+ * les approfondit toutes ensemble, une profondeur à la fois : quel que
+ * soit le moment où le joueur joue, chaque réponse a reçu la même part de
+ * la réflexion. Si la position se présente ensuite et que son coup est
+ * assez approfondi (voir ai_get_move()), il est renvoyé sans chercher ;
+ * sinon la table de transposition remplie au passage accélère la
+ * recherche.
+ *
+ * Au niveau expert, fait grandir l'arbre Monte-Carlo depuis la position
+ * courante (voir mcts_ponder()) ; ai_get_move() repart ensuite du
+ * sous-arbre du coup joué.
+ *
+ * S'arrête quand toutes les réponses sont résolues (l'arbre plein au
+ * niveau expert) ou à la demande d'interruption (ai->stop_flag) ; sans
+ * stop_flag, après au plus ai->time_limit_ms (ai->time_budget_ms au
+ * niveau expert). Doit être appelée par le thread qui appelle
+ * ai_get_move(), jamais en même temps.
+ *
+ * @param game Position, le joueur humain au trait (restaurée au retour)
+ * @param ai Configuration de l'IA
+ */
+void ai_ponder(game_t* game, ai_t* ai);
+
+/**
+ * @brief Écrit l'en-tête d'un relevé de statistiques (CSV uniquement)
+ * @param out Flux de sortie
+ * @param format Format du relevé
+ */
+void ai_stats_write_header(FILE* out, AIStatsFormat format);
+
+/**
+ * @brief Ajoute au relevé les statistiques du dernier coup de l'IA
+ *
+ * Champs : niveau, dimensions du plateau, nombre de pions posés, puis
+ * les champs de ai_stats_t. Le flux est vidé après chaque ligne.
+ *
+ * @param out Flux de sortie
+ * @param format Format du relevé
+ * @param game Position analysée (avant le coup de l'IA)
+ * @param ai IA ayant calculé le coup
+ */
+void ai_stats_write(FILE* out, AIStatsFormat format, const game_t* game, const ai_t* ai);
+
 /**
  * @brief Fait jouer l'IA
  * 
  * Détermine et joue le meilleur coup selon le niveau de difficulté :
  * - EASY : Coup aléatoire
- * - MEDIUM : Stratégie simple ou aléatoire
+ * - MEDIUM : Victoire, parade ou fourchette, sinon coup aléatoire
  * - HARD : Meilleur coup possible (Minimax)
+ * - EXPERT : Coup le plus exploré par la recherche Monte-Carlo
  *
  * @param game Pointeur vers l'état du jeu
  * @param ai Pointeur vers la configuration de l'IA
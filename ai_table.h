@@ -0,0 +1,41 @@
+/**
+ * @file ai_table.h
+ * @brief Table de coups parfaits pour le morpion 3x3
+ *
+ * La table est produite à la compilation par tools/gen_ai_table.c, qui
+ * résout une fois pour toutes chaque position 3x3 avec la recherche du
+ * niveau difficile. Le fichier ai_table.c correspondant est généré dans
+ * le dossier de build.
+ *
+ * Une position est indexée par son codage en base 3 :
+ * index = somme(case_i * 3^i) avec EMPTY = 0, PLAYER_X = 1, PLAYER_O = 2.
+ */
+
+#ifndef AI_TABLE_H_
+#define AI_TABLE_H_
+
+#include <stdint.h>
+
+/** @brief Nombre de cases couvertes par la table */
+#define AI_TABLE_CELLS 9
+
+/** @brief Nombre de positions indexées (3^9) */
+#define AI_TABLE_POSITIONS 19683
+
+/**
+ * @brief Valeur en base 3 d'un masque de 9 bits dont chaque bit vaut 1
+ *
+ * Permet d'obtenir l'index d'une position à partir des deux bitboards :
+ * ai_table_base3[x] + 2 * ai_table_base3[o].
+ */
+extern const uint16_t ai_table_base3[1 << AI_TABLE_CELLS];
+
+/**
+ * @brief Meilleur coup pour chaque position et chaque joueur au trait
+ *
+ * Premier indice : PLAYER_INDEX du joueur au trait. Vaut -1 pour les
+ * positions terminales (victoire ou plateau plein).
+ */
+extern const int8_t ai_table_moves[2][AI_TABLE_POSITIONS];
+
+#endif  /* AI_TABLE_H_ */
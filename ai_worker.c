@@ -0,0 +1,188 @@
+/**
+ * @file ai_worker.c
+ * @brief Implémentation du thread de recherche de l'IA
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include "./ai_worker.h"
+
+/*********************************
+ * Fonctions statiques internes
+ *********************************/
+
+/**
+ * @brief Boucle du thread de recherche
+ *
+ * Attend une demande, la copie, lance la recherche sans tenir le verrou
+ * puis publie le coup, sauf si la demande a été annulée entre-temps. Une
+ * réflexion ne publie rien.
+ */
+static int worker_main(void* data) {
+    ai_worker_t* worker = (ai_worker_t*)data;
+
+    SDL_LockMutex(worker->mutex);
+    for (;;) {
+        while (!worker->has_job && !worker->quit) {
+            SDL_CondWait(worker->cond, worker->mutex);
+        }
+        if (worker->quit) {
+            break;
+        }
+
+        // Prise en charge de la demande
+        game_t game = worker->job_game;
+        ai_t ai = worker->job_ai;
+        const unsigned int id = worker->job_id;
+        const int ponder = worker->job_ponder;
+        worker->has_job = 0;
+        worker->busy = 1;
+        SDL_UnlockMutex(worker->mutex);
+
+        ai.stop_flag = &worker->cancel;
+        if (ponder) {
+            ai_ponder(&game, &ai);
+        } else {
+            const int move = ai_get_move(&game, &ai);
+            if (!ai.search_aborted && move >= 0) {
+                SDL_LockMutex(worker->mutex);
+                worker->result_stats = ai.stats;
+                worker->result_rng = ai.rng;
+                SDL_UnlockMutex(worker->mutex);
+
+                SDL_Event event;
+                SDL_zero(event);
+                event.type = worker->event_type;
+                event.user.code = move;
+                event.user.data1 = (void*)(uintptr_t)id;
+                SDL_PushEvent(&event);
+            }
+        }
+
+        SDL_LockMutex(worker->mutex);
+        worker->busy = 0;
+        SDL_CondBroadcast(worker->cond);
+    }
+    SDL_UnlockMutex(worker->mutex);
+
+    return 0;
+}
+
+/*********************************
+ * Implémentation des fonctions publiques
+ *********************************/
+
+int ai_worker_start(ai_worker_t* worker) {
+    SDL_zerop(worker);
+    atomic_init(&worker->cancel, 0);
+
+    worker->event_type = SDL_RegisterEvents(1);
+    if (worker->event_type == (Uint32)-1) {
+        fprintf(stderr, "Erreur enregistrement événement IA: %s\n", SDL_GetError());
+        return -1;
+    }
+
+    worker->mutex = SDL_CreateMutex();
+    worker->cond = SDL_CreateCond();
+    if (!worker->mutex || !worker->cond) {
+        fprintf(stderr, "Erreur création verrou IA: %s\n", SDL_GetError());
+        ai_worker_stop(worker);
+        return -1;
+    }
+
+    worker->thread = SDL_CreateThread(worker_main, "ai_worker", worker);
+    if (!worker->thread) {
+        fprintf(stderr, "Erreur création thread IA: %s\n", SDL_GetError());
+        ai_worker_stop(worker);
+        return -1;
+    }
+
+    return 0;
+}
+
+void ai_worker_request(ai_worker_t* worker, const game_t* game, const ai_t* ai) {
+    ai_worker_cancel(worker);
+
+    worker->current_id++;
+    worker->pending = 1;
+
+    SDL_LockMutex(worker->mutex);
+    worker->job_game = *game;
+    worker->job_ai = *ai;
+    worker->job_id = worker->current_id;
+    worker->job_ponder = 0;
+    worker->has_job = 1;
+    SDL_CondBroadcast(worker->cond);
+    SDL_UnlockMutex(worker->mutex);
+}
+
+void ai_worker_ponder(ai_worker_t* worker, const game_t* game, const ai_t* ai) {
+    ai_worker_cancel(worker);
+
+    SDL_LockMutex(worker->mutex);
+    worker->job_game = *game;
+    worker->job_ai = *ai;
+    worker->job_id = worker->current_id;
+    worker->job_ponder = 1;
+    worker->has_job = 1;
+    SDL_CondBroadcast(worker->cond);
+    SDL_UnlockMutex(worker->mutex);
+}
+
+void ai_worker_cancel(ai_worker_t* worker) {
+    // Les résultats déjà postés portent un numéro périmé
+    worker->current_id++;
+    worker->pending = 0;
+
+    SDL_LockMutex(worker->mutex);
+    worker->has_job = 0;
+    atomic_store(&worker->cancel, 1);
+    while (worker->busy) {
+        SDL_CondWait(worker->cond, worker->mutex);
+    }
+    atomic_store(&worker->cancel, 0);
+    SDL_UnlockMutex(worker->mutex);
+}
+
+int ai_worker_take_result(ai_worker_t* worker, const SDL_Event* event, int* move, ai_t* ai) {
+    if (!worker->pending || (unsigned int)(uintptr_t)event->user.data1 != worker->current_id) {
+        return 0;
+    }
+
+    worker->pending = 0;
+    *move = event->user.code;
+    if (ai) {
+        SDL_LockMutex(worker->mutex);
+        ai->stats = worker->result_stats;
+        ai->rng = worker->result_rng;
+        SDL_UnlockMutex(worker->mutex);
+    }
+    return 1;
+}
+
+int ai_worker_is_thinking(const ai_worker_t* worker) {
+    return worker->pending;
+}
+
+void ai_worker_stop(ai_worker_t* worker) {
+    if (worker->thread) {
+        ai_worker_cancel(worker);
+
+        SDL_LockMutex(worker->mutex);
+        worker->quit = 1;
+        SDL_CondBroadcast(worker->cond);
+        SDL_UnlockMutex(worker->mutex);
+
+        SDL_WaitThread(worker->thread, NULL);
+        worker->thread = NULL;
+    }
+
+    if (worker->cond) {
+        SDL_DestroyCond(worker->cond);
+        worker->cond = NULL;
+    }
+    if (worker->mutex) {
+        SDL_DestroyMutex(worker->mutex);
+        worker->mutex = NULL;
+    }
+}
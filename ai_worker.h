@@ -0,0 +1,125 @@
+/**
+ * @file ai_worker.h
+ * @brief Recherche de l'IA sur un thread séparé
+ *
+ * Le thread principal confie une copie de la partie au worker, qui
+ * calcule le coup de l'IA pendant que l'interface continue d'afficher
+ * des images. Le coup est renvoyé par un événement SDL utilisateur
+ * (type event_type) :
+ * - event.user.code : case choisie
+ * - event.user.data1 : numéro de la demande (voir ai_worker_take_result)
+ *
+ * Une demande peut être annulée à tout moment (retour au menu, nouvelle
+ * partie) : la recherche en cours s'interrompt et son résultat n'est
+ * jamais livré.
+ *
+ * Entre deux demandes, le worker peut réfléchir pendant le tour du joueur
+ * (ai_worker_ponder) ; toute nouvelle demande interrompt cette réflexion.
+ */
+
+#ifndef AI_WORKER_H_
+#define AI_WORKER_H_
+
+#include <stdatomic.h>
+#include <SDL2/SDL.h>
+#include "./game.h"
+#include "./ai.h"
+
+/**
+ * @brief État du worker
+ *
+ * Les champs protégés par mutex sont partagés avec le thread de
+ * recherche ; les autres ne sont utilisés que par le thread principal.
+ */
+typedef struct {
+    SDL_Thread* thread;     /**< Thread de recherche */
+    SDL_mutex* mutex;       /**< Protège job, has_job, busy, quit et les résultats */
+    SDL_cond* cond;         /**< Signale une nouvelle demande ou la fin d'une recherche */
+    Uint32 event_type;      /**< Type des événements de résultat */
+
+    game_t job_game;        /**< Copie de la partie à analyser */
+    ai_t job_ai;            /**< Copie de la configuration de l'IA */
+    unsigned int job_id;    /**< Numéro de la demande en attente */
+    int has_job;            /**< Une demande attend d'être prise en charge */
+    int job_ponder;         /**< La demande est une réflexion (aucun résultat) */
+    int busy;               /**< Une recherche est en cours */
+    int quit;               /**< Le thread doit se terminer */
+    ai_stats_t result_stats; /**< Statistiques du dernier coup calculé */
+    rng_t result_rng;       /**< Générateur de l'IA après le dernier coup calculé */
+
+    atomic_int cancel;      /**< Interrompt la recherche en cours */
+    unsigned int current_id; /**< Numéro de la dernière demande */
+    int pending;            /**< La dernière demande attend son résultat */
+} ai_worker_t;
+
+/**
+ * @brief Crée le thread de recherche et enregistre le type d'événement
+ * @param worker Worker à initialiser
+ * @return 0 en cas de succès, -1 en cas d'erreur
+ */
+int ai_worker_start(ai_worker_t* worker);
+
+/**
+ * @brief Demande le coup de l'IA pour une position
+ *
+ * La partie et la configuration de l'IA sont copiées : l'appelant peut
+ * continuer à les utiliser. Une demande précédente est annulée.
+ *
+ * @param worker Worker démarré
+ * @param game Position à analyser
+ * @param ai Configuration de l'IA
+ */
+void ai_worker_request(ai_worker_t* worker, const game_t* game, const ai_t* ai);
+
+/**
+ * @brief Fait réfléchir l'IA pendant le tour du joueur
+ *
+ * Lance ai_ponder() sur une copie de la position : aucun résultat n'est
+ * livré, mais la demande suivante (ai_worker_request) profite des coups
+ * préparés. Une demande précédente est annulée.
+ *
+ * @param worker Worker démarré
+ * @param game Position, le joueur humain au trait
+ * @param ai Configuration de l'IA
+ */
+void ai_worker_ponder(ai_worker_t* worker, const game_t* game, const ai_t* ai);
+
+/**
+ * @brief Annule la demande en cours et attend l'arrêt de la recherche
+ *
+ * Au retour, le thread de recherche ne touche plus aux tables de l'IA
+ * et aucun résultat de la demande annulée ne sera pris en compte.
+ *
+ * @param worker Worker démarré
+ */
+void ai_worker_cancel(ai_worker_t* worker);
+
+/**
+ * @brief Lit le coup porté par un événement de résultat
+ *
+ * La recherche travaille sur une copie de l'IA : ses statistiques et
+ * l'état de son générateur sont recopiés dans ai, pour que la demande
+ * suivante continue la même suite de tirages.
+ *
+ * @param worker Worker démarré
+ * @param event Événement de type worker->event_type
+ * @param move Reçoit la case choisie
+ * @param ai Reçoit les statistiques et le générateur (peut être NULL)
+ * @return 1 si le coup répond à la dernière demande, 0 s'il provient
+ *         d'une demande annulée ou remplacée et doit être ignoré
+ */
+int ai_worker_take_result(ai_worker_t* worker, const SDL_Event* event, int* move, ai_t* ai);
+
+/**
+ * @brief Indique si une demande attend encore son résultat
+ * @param worker Worker démarré
+ */
+int ai_worker_is_thinking(const ai_worker_t* worker);
+
+/**
+ * @brief Arrête le thread de recherche et libère les ressources
+ * @param worker Worker démarré
+ */
+void ai_worker_stop(ai_worker_t* worker);
+
+#endif  /* AI_WORKER_H_ */
@@ -0,0 +1,231 @@
+/**
+ * @file batch.c
+ * @brief Implémentation des lots de parties
+ *
+ * Les versions SSE2 et AVX2 de game_batch_evaluate() sont compilées pour
+ * leur jeu d'instructions (attribut target) et choisies à l'exécution :
+ * le programme reste utilisable sur un processeur sans AVX2.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "./batch.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define BATCH_HAS_AVX2 1
+#endif
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define BATCH_HAS_SSE2 1
+#endif
+
+/*********************************
+ * Fonctions utilitaires statiques
+ *********************************/
+
+/** @brief Alignement des tableaux du lot (un registre AVX2) */
+#define BATCH_ALIGNMENT 32
+
+/** @brief Parties par registre AVX2, granularité de padded_count */
+#define BATCH_LANES 4
+
+/**
+ * @brief État d'une partie à partir des résultats des comparaisons
+ */
+static inline uint8_t batch_state(int x_won, int o_won, int full) {
+    if (x_won) return PLAYER_X_WON_STATE;
+    if (o_won) return PLAYER_O_WON_STATE;
+    if (full) return TIE_STATE;
+    return RUNNING_STATE;
+}
+
+/**
+ * @brief Version scalaire : une partie, puis une ligne, à la fois
+ */
+static void evaluate_scalar(const game_batch_t* batch, uint8_t* states) {
+    const board_config_t* config = batch->config;
+    const uint64_t* lines = config->small_lines;
+    const int line_count = config->small_line_count;
+    const uint64_t full = config->full_mask.words[0];
+
+    for (int g = 0; g < batch->count; g++) {
+        const uint64_t x = batch->boards[0][g];
+        const uint64_t o = batch->boards[1][g];
+        int x_won = 0, o_won = 0;
+        for (int l = 0; l < line_count; l++) {
+            x_won |= (x & lines[l]) == lines[l];
+            o_won |= (o & lines[l]) == lines[l];
+        }
+        states[g] = batch_state(x_won, o_won, (x | o) == full);
+    }
+}
+
+#ifdef BATCH_HAS_SSE2
+/**
+ * @brief Égalité de mots de 64 bits en SSE2 (pcmpeqq n'existe qu'en SSE4.1)
+ *
+ * Les deux moitiés de 32 bits doivent être égales.
+ */
+static inline __m128i cmpeq_epi64_sse2(__m128i a, __m128i b) {
+    const __m128i equal = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+/**
+ * @brief Version SSE2 : deux parties par instruction
+ */
+static void evaluate_sse2(const game_batch_t* batch, uint8_t* states) {
+    const board_config_t* config = batch->config;
+    const uint64_t* lines = config->small_lines;
+    const int line_count = config->small_line_count;
+    const __m128i full = _mm_set1_epi64x((long long)config->full_mask.words[0]);
+
+    for (int g = 0; g < batch->count; g += 2) {
+        const __m128i x = _mm_load_si128((const __m128i*)&batch->boards[0][g]);
+        const __m128i o = _mm_load_si128((const __m128i*)&batch->boards[1][g]);
+        __m128i x_won = _mm_setzero_si128();
+        __m128i o_won = _mm_setzero_si128();
+        for (int l = 0; l < line_count; l++) {
+            const __m128i line = _mm_set1_epi64x((long long)lines[l]);
+            x_won = _mm_or_si128(x_won, cmpeq_epi64_sse2(_mm_and_si128(x, line), line));
+            o_won = _mm_or_si128(o_won, cmpeq_epi64_sse2(_mm_and_si128(o, line), line));
+        }
+        const __m128i filled = cmpeq_epi64_sse2(_mm_or_si128(x, o), full);
+
+        const int x_bits = _mm_movemask_pd(_mm_castsi128_pd(x_won));
+        const int o_bits = _mm_movemask_pd(_mm_castsi128_pd(o_won));
+        const int full_bits = _mm_movemask_pd(_mm_castsi128_pd(filled));
+        const int lanes = (batch->count - g < 2) ? batch->count - g : 2;
+        for (int i = 0; i < lanes; i++) {
+            states[g + i] = batch_state((x_bits >> i) & 1, (o_bits >> i) & 1,
+                                        (full_bits >> i) & 1);
+        }
+    }
+}
+#endif
+
+#ifdef BATCH_HAS_AVX2
+/**
+ * @brief Version AVX2 : quatre parties par instruction
+ */
+__attribute__((target("avx2")))
+static void evaluate_avx2(const game_batch_t* batch, uint8_t* states) {
+    const board_config_t* config = batch->config;
+    const uint64_t* lines = config->small_lines;
+    const int line_count = config->small_line_count;
+    const __m256i full = _mm256_set1_epi64x((long long)config->full_mask.words[0]);
+
+    for (int g = 0; g < batch->count; g += BATCH_LANES) {
+        const __m256i x = _mm256_load_si256((const __m256i*)&batch->boards[0][g]);
+        const __m256i o = _mm256_load_si256((const __m256i*)&batch->boards[1][g]);
+        __m256i x_won = _mm256_setzero_si256();
+        __m256i o_won = _mm256_setzero_si256();
+        for (int l = 0; l < line_count; l++) {
+            const __m256i line = _mm256_set1_epi64x((long long)lines[l]);
+            x_won = _mm256_or_si256(x_won, _mm256_cmpeq_epi64(_mm256_and_si256(x, line), line));
+            o_won = _mm256_or_si256(o_won, _mm256_cmpeq_epi64(_mm256_and_si256(o, line), line));
+        }
+        const __m256i filled = _mm256_cmpeq_epi64(_mm256_or_si256(x, o), full);
+
+        const int x_bits = _mm256_movemask_pd(_mm256_castsi256_pd(x_won));
+        const int o_bits = _mm256_movemask_pd(_mm256_castsi256_pd(o_won));
+        const int full_bits = _mm256_movemask_pd(_mm256_castsi256_pd(filled));
+        const int lanes = (batch->count - g < BATCH_LANES) ? batch->count - g : BATCH_LANES;
+        for (int i = 0; i < lanes; i++) {
+            states[g + i] = batch_state((x_bits >> i) & 1, (o_bits >> i) & 1,
+                                        (full_bits >> i) & 1);
+        }
+    }
+}
+#endif
+
+/*********************************
+ * Implémentation des fonctions publiques
+ *********************************/
+
+BatchSimd game_batch_best_simd(void) {
+#ifdef BATCH_HAS_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        return BATCH_SIMD_AVX2;
+    }
+#endif
+#ifdef BATCH_HAS_SSE2
+    return BATCH_SIMD_SSE2;
+#else
+    return BATCH_SIMD_SCALAR;
+#endif
+}
+
+const char* game_batch_simd_name(BatchSimd simd) {
+    switch (simd) {
+        case BATCH_SIMD_SSE2: return "sse2";
+        case BATCH_SIMD_AVX2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+int game_batch_init(game_batch_t* batch, const board_config_t* config, int count) {
+    memset(batch, 0, sizeof(*batch));
+    if (config->cell_count > 64 || count < 1) {
+        return -1;
+    }
+
+    batch->config = config;
+    batch->count = count;
+    batch->padded_count = (count + BATCH_LANES - 1) / BATCH_LANES * BATCH_LANES;
+    batch->simd = game_batch_best_simd();
+
+    const size_t size = (size_t)batch->padded_count * sizeof(uint64_t);
+    for (int p = 0; p < 2; p++) {
+        batch->boards[p] = aligned_alloc(BATCH_ALIGNMENT, size);
+        if (!batch->boards[p]) {
+            game_batch_free(batch);
+            return -1;
+        }
+    }
+
+    game_batch_reset(batch);
+    return 0;
+}
+
+void game_batch_free(game_batch_t* batch) {
+    for (int p = 0; p < 2; p++) {
+        free(batch->boards[p]);
+        batch->boards[p] = NULL;
+    }
+}
+
+void game_batch_reset(game_batch_t* batch) {
+    const size_t size = (size_t)batch->padded_count * sizeof(uint64_t);
+    memset(batch->boards[0], 0, size);
+    memset(batch->boards[1], 0, size);
+}
+
+void game_batch_play(game_batch_t* batch, int player, const int16_t* cells) {
+    uint64_t* boards = batch->boards[PLAYER_INDEX(player)];
+    for (int g = 0; g < batch->count; g++) {
+        if (cells[g] >= 0) {
+            boards[g] |= (uint64_t)1 << cells[g];
+        }
+    }
+}
+
+void game_batch_evaluate(const game_batch_t* batch, uint8_t* states) {
+    switch (batch->simd) {
+#ifdef BATCH_HAS_AVX2
+        case BATCH_SIMD_AVX2:
+            evaluate_avx2(batch, states);
+            break;
+#endif
+#ifdef BATCH_HAS_SSE2
+        case BATCH_SIMD_SSE2:
+            evaluate_sse2(batch, states);
+            break;
+#endif
+        default:
+            evaluate_scalar(batch, states);
+            break;
+    }
+}
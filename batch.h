@@ -0,0 +1,100 @@
+/**
+ * @file batch.h
+ * @brief Lots de parties jouées en parallèle (entraînement, benchmarks)
+ *
+ * Un lot contient count parties indépendantes sur le même plateau, qui
+ * avancent au même rythme : un appel joue un coup dans chacune, un autre
+ * détermine l'état de toutes. Les plateaux sont rangés par joueur
+ * (structure de tableaux) : boards[p][g] est le masque du joueur p dans
+ * la partie g, ce qui permet de tester plusieurs parties par instruction
+ * SIMD (SSE2 : 2 parties, AVX2 : 4 parties).
+ *
+ * Seuls les plateaux d'au plus 64 cases sont pris en charge : une partie
+ * tient alors dans un mot de 64 bits par joueur et les lignes gagnantes
+ * sont les masques board_config_t.small_lines.
+ */
+
+#ifndef BATCH_H_
+#define BATCH_H_
+
+#include <stdint.h>
+#include "./game.h"
+
+/** @brief Jeux d'instructions utilisables pour game_batch_evaluate() */
+typedef enum {
+    BATCH_SIMD_SCALAR = 0,  /**< Une partie à la fois */
+    BATCH_SIMD_SSE2 = 1,    /**< Deux parties par instruction */
+    BATCH_SIMD_AVX2 = 2     /**< Quatre parties par instruction */
+} BatchSimd;
+
+/**
+ * @brief Lot de parties
+ *
+ * Les tableaux ont padded_count éléments, alignés sur 32 octets ; les
+ * parties au-delà de count restent vides et ne sont jamais renvoyées.
+ */
+typedef struct {
+    const board_config_t* config;  /**< Plateau commun à toutes les parties */
+    int count;                     /**< Nombre de parties */
+    int padded_count;              /**< count arrondi au multiple de 4 supérieur */
+    uint64_t* boards[2];           /**< Masques de X puis de O, une entrée par partie */
+    BatchSimd simd;                /**< Jeu d'instructions utilisé : le meilleur disponible, ou un plus lent */
+} game_batch_t;
+
+/**
+ * @brief Jeu d'instructions le plus rapide disponible sur ce processeur
+ */
+BatchSimd game_batch_best_simd(void);
+
+/**
+ * @brief Nom d'un jeu d'instructions ("scalar", "sse2", "avx2")
+ */
+const char* game_batch_simd_name(BatchSimd simd);
+
+/**
+ * @brief Alloue un lot de parties vides
+ * @param batch Lot à initialiser
+ * @param config Plateau d'au plus 64 cases
+ * @param count Nombre de parties (au moins 1)
+ * @return 0 en cas de succès, -1 si le plateau est trop grand ou si la
+ *         mémoire manque
+ */
+int game_batch_init(game_batch_t* batch, const board_config_t* config, int count);
+
+/**
+ * @brief Libère les tableaux du lot
+ */
+void game_batch_free(game_batch_t* batch);
+
+/**
+ * @brief Vide toutes les parties du lot
+ */
+void game_batch_reset(game_batch_t* batch);
+
+/**
+ * @brief Joue un coup du même joueur dans chaque partie
+ *
+ * Les cases doivent être vides ; cells[g] < 0 laisse la partie g
+ * inchangée (partie terminée, par exemple).
+ *
+ * @param batch Lot de parties
+ * @param player Joueur qui joue (PLAYER_X ou PLAYER_O)
+ * @param cells Case jouée dans chaque partie (count éléments)
+ */
+void game_batch_play(game_batch_t* batch, int player, const int16_t* cells);
+
+/**
+ * @brief Détermine l'état de toutes les parties
+ *
+ * Compare les masques des deux joueurs à chaque ligne gagnante avec le
+ * jeu d'instructions batch->simd. Une partie où les deux joueurs ont
+ * aligné (coups joués après la fin) est comptée comme gagnée par X.
+ *
+ * @param batch Lot de parties
+ * @param states Reçoit RUNNING_STATE, PLAYER_X_WON_STATE,
+ *               PLAYER_O_WON_STATE ou TIE_STATE pour chaque partie
+ *               (count éléments)
+ */
+void game_batch_evaluate(const game_batch_t* batch, uint8_t* states);
+
+#endif  /* BATCH_H_ */
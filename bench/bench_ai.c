@@ -0,0 +1,182 @@
+/**
+ * @file bench_ai.c
+ * @brief Nombre de nœuds visités par la recherche du niveau difficile
+ *
+ * Compare le Minimax exhaustif d'origine (sans élagage ni mémoïsation)
+ * à la recherche alpha-beta avec table de transposition de ai.c, sans puis
+ * avec fusion des positions symétriques, et vérifie que le coup choisi a
+ * la même valeur théorique.
+ *
+ * Le Minimax de référence n'est lancé que sur le plateau 3x3 : au-delà,
+ * l'arbre complet est hors de portée.
+ *
+ * Usage : bench_ai [largeur hauteur k] (3 3 3 par défaut)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../game.h"
+#include "../logic.h"
+#include "../ai.h"
+
+/** @brief Taille maximale de plateau pour le Minimax de référence */
+#define REFERENCE_MAX_CELLS 9
+
+/*********************************
+ * Minimax de référence
+ *********************************/
+
+static unsigned long reference_nodes;
+
+/**
+ * @brief Minimax exhaustif, même convention de score que ai.c
+ */
+static int reference_negamax(game_t* game, int player, int ply) {
+    reference_nodes++;
+
+    const int opponent = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    int best = SCORE_LOSS - 1;
+    int has_move = 0;
+
+    for (int i = 0; i < game->config->cell_count; i++) {
+        if (get_cell(game, i) != EMPTY) continue;
+        has_move = 1;
+
+        int score;
+        set_cell(game, i, player);
+        if (check_player_won(game, player)) {
+            score = SCORE_WIN - (ply + 1);
+        } else {
+            score = -reference_negamax(game, opponent, ply + 1);
+        }
+        clear_cell(game, i);
+
+        if (score > best) best = score;
+    }
+
+    return has_move ? best : SCORE_DRAW;
+}
+
+/**
+ * @brief Valeur théorique du coup joué, du point de vue de celui qui le joue
+ */
+static int move_value(game_t* game, int player, int move) {
+    const int opponent = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    set_cell(game, move, player);
+    int value = check_player_won(game, player)
+              ? SCORE_WIN - 1
+              : -reference_negamax(game, opponent, 1);
+    clear_cell(game, move);
+    return value;
+}
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Lance la recherche du niveau difficile sur une copie de la position
+ *
+ * @param game Position de départ
+ * @param use_symmetry Active la fusion des positions symétriques
+ * @param nodes Reçoit le nombre de nœuds visités
+ * @param seconds Reçoit la durée de la recherche
+ * @return Coup choisi
+ */
+static int run_search(const game_t* game, int use_symmetry,
+                      unsigned long* nodes, double* seconds) {
+    ai_t ai;
+    game_t copy = *game;
+
+    // Table de transposition vide pour une mesure à froid
+    init_ai(&ai, HARD);
+    ai.use_symmetry = use_symmetry;
+    ai.time_limit_ms = 0;  // Recherche complète, reproductible
+
+    double start = now_seconds();
+    int move = ai_get_move(&copy, &ai);
+    *seconds = now_seconds() - start;
+    *nodes = ai.stats.nodes;
+    return move;
+}
+
+/**
+ * @brief Mesure une position : nœuds et temps pour chaque variante
+ * @return 0 si le coup choisi est optimal, 1 sinon
+ */
+static int bench_position(const char* name, game_t* game) {
+    unsigned long plain_nodes, symmetry_nodes;
+    double plain_time, symmetry_time;
+
+    run_search(game, 0, &plain_nodes, &plain_time);
+    int move = run_search(game, 1, &symmetry_nodes, &symmetry_time);
+
+    printf("%-16s", name);
+
+    int ok = 1;
+    if (game->config->cell_count <= REFERENCE_MAX_CELLS) {
+        reference_nodes = 0;
+        double start = now_seconds();
+        int reference_value = reference_negamax(game, game->player, 0);
+        double reference_time = now_seconds() - start;
+        printf(" minimax %9lu nœuds %8.2f ms |", reference_nodes, reference_time * 1e3);
+
+        ok = (move_value(game, game->player, move) == reference_value);
+    }
+
+    printf(" alpha-beta+TT %9lu nœuds %8.2f ms | + symétries %9lu nœuds %8.2f ms (-%.0f%%) %s\n",
+           plain_nodes, plain_time * 1e3,
+           symmetry_nodes, symmetry_time * 1e3,
+           100.0 * (1.0 - (double)symmetry_nodes / plain_nodes),
+           ok ? "" : "(COUP NON OPTIMAL)");
+    return !ok;
+}
+
+int main(int argc, char* argv[]) {
+    int width = DEFAULT_BOARD_WIDTH;
+    int height = DEFAULT_BOARD_HEIGHT;
+    int win_length = DEFAULT_WIN_LENGTH;
+
+    if (argc == 4) {
+        width = atoi(argv[1]);
+        height = atoi(argv[2]);
+        win_length = atoi(argv[3]);
+    } else if (argc != 1) {
+        fprintf(stderr, "Usage : %s [largeur hauteur k]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    game_t game = {0};
+    game.config = get_board_config(width, height, win_length);
+    if (!game.config) {
+        fprintf(stderr, "Plateau %dx%d, k=%d non supporté\n", width, height, win_length);
+        return EXIT_FAILURE;
+    }
+
+    const int last_row = height - 1;
+    const int last_col = width - 1;
+    int errors = 0;
+
+    reset_game(&game);
+    errors += bench_position("plateau vide", &game);
+
+    reset_game(&game);
+    click_on_cell(&game, last_row / 2, last_col / 2);
+    errors += bench_position("X au centre", &game);
+
+    reset_game(&game);
+    click_on_cell(&game, 0, 0);
+    errors += bench_position("X dans un coin", &game);
+
+    reset_game(&game);
+    click_on_cell(&game, 0, 0);
+    click_on_cell(&game, last_row / 2, last_col / 2);
+    click_on_cell(&game, last_row, last_col);
+    errors += bench_position("3 coups joués", &game);
+
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
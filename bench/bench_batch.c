@@ -0,0 +1,189 @@
+/**
+ * @file bench_batch.c
+ * @brief Débit des lots de parties (batch.h) face aux vérifications partie par partie
+ *
+ * Tire BATCH_GAMES positions au hasard, vérifie que game_batch_evaluate()
+ * donne le même état que check_player_won() pour chaque jeu d'instructions
+ * disponible, puis mesure le nombre de parties évaluées par seconde :
+ * - partie par partie (check_player_won pour X et O, plateau plein) ;
+ * - par lot, en scalaire, SSE2 et AVX2.
+ * Enfin, joue des lots de parties aléatoires complètes au même rythme.
+ *
+ * Usage : bench_batch [largeur hauteur k]   (3 3 3 par défaut, 64 cases au plus)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../game.h"
+#include "../logic.h"
+#include "../batch.h"
+
+/** @brief Nombre de parties du lot */
+#define BATCH_GAMES 4096
+
+/** @brief Nombre de passes sur l'ensemble des positions */
+#define PASS_COUNT 2000
+
+/** @brief Nombre de lots de parties aléatoires complètes */
+#define PLAYOUT_ROUNDS 200
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Générateur xorshift64* des coups aléatoires
+ */
+static uint64_t next_random(uint64_t* state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545F4914F6CDD1Dull;
+}
+
+/**
+ * @brief Case vide tirée au hasard dans une partie du lot
+ */
+static int16_t random_empty_cell(const game_batch_t* batch, int g, uint64_t* rng) {
+    uint64_t empty = ~(batch->boards[0][g] | batch->boards[1][g]) &
+                     batch->config->full_mask.words[0];
+    int skip = (int)(next_random(rng) % (uint64_t)__builtin_popcountll(empty));
+    while (skip-- > 0) {
+        empty &= empty - 1;
+    }
+    return (int16_t)__builtin_ctzll(empty);
+}
+
+/**
+ * @brief État d'une partie, calculé par les fonctions de logic.h
+ */
+static uint8_t reference_state(const game_t* game) {
+    if (check_player_won(game, PLAYER_X)) return PLAYER_X_WON_STATE;
+    if (check_player_won(game, PLAYER_O)) return PLAYER_O_WON_STATE;
+    if (is_board_full(game)) return TIE_STATE;
+    return RUNNING_STATE;
+}
+
+int main(int argc, char* argv[]) {
+    int width = 3, height = 3, win_length = 3;
+    if (argc == 4) {
+        width = atoi(argv[1]);
+        height = atoi(argv[2]);
+        win_length = atoi(argv[3]);
+    } else if (argc != 1) {
+        fprintf(stderr, "Usage : %s [largeur hauteur k]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const board_config_t* config = get_board_config(width, height, win_length);
+    static game_batch_t batch;
+    if (!config || game_batch_init(&batch, config, BATCH_GAMES) < 0) {
+        fprintf(stderr, "Plateau non supporté (64 cases au plus)\n");
+        return EXIT_FAILURE;
+    }
+
+    // Positions aléatoires construites au même rythme dans le lot et dans
+    // des game_t : chaque partie s'arrête à une longueur tirée au hasard
+    // ou à sa fin
+    static game_t games[BATCH_GAMES];
+    static int lengths[BATCH_GAMES];
+    static int16_t cells[BATCH_GAMES];
+    static uint8_t states[BATCH_GAMES];
+    uint64_t rng = 0x9E3779B97F4A7C15ull;
+
+    for (int g = 0; g < BATCH_GAMES; g++) {
+        games[g].config = config;
+        reset_game(&games[g]);
+        lengths[g] = (int)(next_random(&rng) % (uint64_t)(config->cell_count + 1));
+    }
+    for (int ply = 0; ply < config->cell_count; ply++) {
+        const int player = (ply % 2 == 0) ? PLAYER_X : PLAYER_O;
+        for (int g = 0; g < BATCH_GAMES; g++) {
+            cells[g] = -1;
+            if (ply < lengths[g] && games[g].state == RUNNING_STATE) {
+                cells[g] = random_empty_cell(&batch, g, &rng);
+                if (make_move(&games[g], cells[g], player)) {
+                    games[g].state = (player == PLAYER_X) ? PLAYER_X_WON_STATE
+                                                          : PLAYER_O_WON_STATE;
+                }
+            }
+        }
+        game_batch_play(&batch, player, cells);
+    }
+
+    // Concordance avec check_player_won
+    const BatchSimd best = batch.simd;
+    for (int simd = BATCH_SIMD_SCALAR; simd <= (int)best; simd++) {
+        batch.simd = (BatchSimd)simd;
+        game_batch_evaluate(&batch, states);
+        for (int g = 0; g < BATCH_GAMES; g++) {
+            if (states[g] != reference_state(&games[g])) {
+                fprintf(stderr, "ERREUR : %s, partie %d\n", game_batch_simd_name(batch.simd), g);
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    printf("%dx%d, k=%d, %d lignes gagnantes, %d parties par lot\n", width, height,
+           win_length, config->small_line_count, BATCH_GAMES);
+
+    // Partie par partie
+    const long evaluations = (long)BATCH_GAMES * PASS_COUNT;
+    volatile unsigned long checksum = 0;  // Empêche le compilateur de supprimer les boucles
+    double begin = now_seconds();
+    for (int pass = 0; pass < PASS_COUNT; pass++) {
+        for (int g = 0; g < BATCH_GAMES; g++) {
+            checksum += reference_state(&games[g]);
+        }
+    }
+    const double reference = now_seconds() - begin;
+    printf("  %-16s %8.2f ns/partie  %9.1f M parties/s\n", "check_player_won",
+           reference * 1e9 / evaluations, evaluations / reference * 1e-6);
+
+    // Par lot
+    for (int simd = BATCH_SIMD_SCALAR; simd <= (int)best; simd++) {
+        batch.simd = (BatchSimd)simd;
+        begin = now_seconds();
+        for (int pass = 0; pass < PASS_COUNT; pass++) {
+            game_batch_evaluate(&batch, states);
+            checksum += states[pass % BATCH_GAMES];
+        }
+        const double elapsed = now_seconds() - begin;
+        printf("  lot %-12s %8.2f ns/partie  %9.1f M parties/s  x%.1f\n",
+               game_batch_simd_name(batch.simd), elapsed * 1e9 / evaluations,
+               evaluations / elapsed * 1e-6, reference / elapsed);
+    }
+
+    // Parties aléatoires complètes, toutes au même rythme
+    batch.simd = best;
+    unsigned long results[4] = {0};
+    begin = now_seconds();
+    for (int round = 0; round < PLAYOUT_ROUNDS; round++) {
+        game_batch_reset(&batch);
+        for (int ply = 0; ply < config->cell_count; ply++) {
+            game_batch_evaluate(&batch, states);
+            for (int g = 0; g < BATCH_GAMES; g++) {
+                cells[g] = (states[g] == RUNNING_STATE) ? random_empty_cell(&batch, g, &rng) : -1;
+            }
+            game_batch_play(&batch, (ply % 2 == 0) ? PLAYER_X : PLAYER_O, cells);
+        }
+        game_batch_evaluate(&batch, states);
+        for (int g = 0; g < BATCH_GAMES; g++) {
+            results[states[g]]++;
+        }
+    }
+    const double elapsed = now_seconds() - begin;
+    const unsigned long playouts = (unsigned long)BATCH_GAMES * PLAYOUT_ROUNDS;
+    printf("parties aléatoires (%s) : %.1f M parties/s, X %.1f %%, O %.1f %%, nuls %.1f %%\n",
+           game_batch_simd_name(best), playouts / elapsed * 1e-6,
+           100.0 * results[PLAYER_X_WON_STATE] / playouts,
+           100.0 * results[PLAYER_O_WON_STATE] / playouts,
+           100.0 * results[TIE_STATE] / playouts);
+
+    game_batch_free(&batch);
+    return EXIT_SUCCESS;
+}
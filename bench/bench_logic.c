@@ -0,0 +1,167 @@
+/**
+ * @file bench_logic.c
+ * @brief Mesure du coût par appel de check_player_won et count_cells
+ *
+ * Compare la version par bitboards à une implémentation par tableau
+ * d'entiers qui parcourt chaque fenêtre de k cases, sur les plateaux
+ * 3x3 (k=3), 4x4 (k=4) et 15x15 (k=5).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../game.h"
+#include "../logic.h"
+
+/** @brief Nombre de positions tirées au hasard */
+#define POSITION_COUNT 4096
+
+/** @brief Nombre de passes sur l'ensemble des positions */
+#define PASS_COUNT 200
+
+/*********************************
+ * Implémentation de référence (tableau d'entiers)
+ *********************************/
+
+static int reference_player_won(const board_config_t* config, const int* board, int player) {
+    static const int steps[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+    const int k = config->win_length;
+
+    for (int i = 0; i < config->height; ++i) {
+        for (int j = 0; j < config->width; ++j) {
+            for (int d = 0; d < 4; ++d) {
+                int count = 0;
+                int row = i, col = j;
+                while (count < k && IS_VALID_CELL(config, row, col) &&
+                       board[BOARD_INDEX(config, row, col)] == player) {
+                    count++;
+                    row += steps[d][0];
+                    col += steps[d][1];
+                }
+                if (count >= k) return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+static int reference_count_cells(const board_config_t* config, const int* board, int cell_type) {
+    int count = 0;
+    for (int i = 0; i < config->cell_count; ++i) {
+        if (board[i] == cell_type) count++;
+    }
+    return count;
+}
+
+/*********************************
+ * Outils de mesure
+ *********************************/
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void report(const char* name, double reference, double bitboard, long calls) {
+    printf("  %-18s reference %7.2f ns/appel | bitboard %7.2f ns/appel | x%.1f\n",
+           name, reference * 1e9 / calls, bitboard * 1e9 / calls, reference / bitboard);
+}
+
+/**
+ * @brief Mesure les deux fonctions sur un plateau donné
+ * @return 0 si les deux implémentations concordent, 1 sinon
+ */
+static int bench_board(int width, int height, int win_length) {
+    static int boards[POSITION_COUNT][MAX_CELLS];
+    static game_t games[POSITION_COUNT];
+    const board_config_t* config = get_board_config(width, height, win_length);
+
+    printf("%dx%d, k=%d\n", width, height, win_length);
+
+    // Positions aléatoires avec un nombre de coups quelconque
+    srand(42);
+    for (int p = 0; p < POSITION_COUNT; ++p) {
+        games[p].config = config;
+        bitboard_clear_all(&games[p].boards[0]);
+        bitboard_clear_all(&games[p].boards[1]);
+        for (int i = 0; i < config->cell_count; ++i) {
+            boards[p][i] = rand() % 3;
+            if (boards[p][i] != EMPTY) {
+                set_cell(&games[p], i, boards[p][i]);
+            }
+        }
+    }
+
+    const long calls = (long)POSITION_COUNT * PASS_COUNT * 2;
+    volatile long sink = 0;
+    long checksum_reference = 0;
+    long checksum_bitboard = 0;
+
+    // check_player_won
+    double start = now_seconds();
+    for (int pass = 0; pass < PASS_COUNT; ++pass) {
+        for (int p = 0; p < POSITION_COUNT; ++p) {
+            checksum_reference += reference_player_won(config, boards[p], PLAYER_X);
+            checksum_reference += reference_player_won(config, boards[p], PLAYER_O);
+        }
+    }
+    double reference_time = now_seconds() - start;
+
+    start = now_seconds();
+    for (int pass = 0; pass < PASS_COUNT; ++pass) {
+        for (int p = 0; p < POSITION_COUNT; ++p) {
+            checksum_bitboard += check_player_won(&games[p], PLAYER_X);
+            checksum_bitboard += check_player_won(&games[p], PLAYER_O);
+        }
+    }
+    double bitboard_time = now_seconds() - start;
+
+    if (checksum_reference != checksum_bitboard) {
+        fprintf(stderr, "Résultats divergents pour check_player_won\n");
+        return 1;
+    }
+    report("check_player_won", reference_time, bitboard_time, calls);
+    sink += checksum_bitboard;
+
+    // count_cells
+    checksum_reference = 0;
+    checksum_bitboard = 0;
+
+    start = now_seconds();
+    for (int pass = 0; pass < PASS_COUNT; ++pass) {
+        for (int p = 0; p < POSITION_COUNT; ++p) {
+            checksum_reference += reference_count_cells(config, boards[p], EMPTY);
+            checksum_reference += reference_count_cells(config, boards[p], PLAYER_X);
+        }
+    }
+    reference_time = now_seconds() - start;
+
+    start = now_seconds();
+    for (int pass = 0; pass < PASS_COUNT; ++pass) {
+        for (int p = 0; p < POSITION_COUNT; ++p) {
+            checksum_bitboard += count_cells(&games[p], EMPTY);
+            checksum_bitboard += count_cells(&games[p], PLAYER_X);
+        }
+    }
+    bitboard_time = now_seconds() - start;
+
+    if (checksum_reference != checksum_bitboard) {
+        fprintf(stderr, "Résultats divergents pour count_cells\n");
+        return 1;
+    }
+    report("count_cells", reference_time, bitboard_time, calls);
+    sink += checksum_bitboard;
+
+    (void)sink;
+    return 0;
+}
+
+int main(void) {
+    int errors = 0;
+    errors += bench_board(3, 3, 3);
+    errors += bench_board(4, 4, 4);
+    errors += bench_board(15, 15, 5);
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file bench_ordering.c
+ * @brief Effet du tri des coups sur la recherche du niveau difficile
+ *
+ * Sur quelques positions, lance la recherche à froid (un seul thread)
+ * sans puis avec tri des coups et affiche le nombre de nœuds, le nombre
+ * de coupures alpha-beta et la part de coupures obtenues dès le premier
+ * coup essayé, qui mesure la qualité du tri.
+ *
+ * Sur les grands plateaux, les deux variantes ne considèrent que les
+ * cases voisines des pions : seul l'ordre des coups change.
+ *
+ * Usage : bench_ordering [largeur hauteur k] (4 4 4 par défaut)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../game.h"
+#include "../logic.h"
+#include "../ai.h"
+
+/** @brief Nombre de positions mesurées */
+#define POSITION_COUNT 4
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Prépare les positions mesurées : plateau vide, puis 1 à 3 coups joués
+ */
+static void build_positions(const board_config_t* config, game_t* positions, const char** names) {
+    const int last_row = config->height - 1;
+    const int last_col = config->width - 1;
+
+    for (int p = 0; p < POSITION_COUNT; p++) {
+        positions[p] = (game_t){0};
+        positions[p].config = config;
+        reset_game(&positions[p]);
+    }
+
+    names[0] = "plateau vide";
+
+    names[1] = "X au centre";
+    click_on_cell(&positions[1], last_row / 2, last_col / 2);
+
+    names[2] = "X dans un coin";
+    click_on_cell(&positions[2], 0, 0);
+
+    names[3] = "3 coups joués";
+    click_on_cell(&positions[3], 0, 0);
+    click_on_cell(&positions[3], last_row / 2, last_col / 2);
+    click_on_cell(&positions[3], last_row, last_col);
+}
+
+/**
+ * @brief Recherche à froid d'une position et affichage des compteurs
+ * @return Nombre de nœuds visités
+ */
+static unsigned long run(const game_t* position, int use_move_ordering) {
+    ai_t ai;
+    game_t copy = *position;
+
+    // Table de transposition vide pour une mesure à froid
+    init_ai(&ai, HARD);
+    ai.thread_count = 1;
+    ai.time_limit_ms = 0;
+    ai.use_move_ordering = use_move_ordering;
+
+    double start = now_seconds();
+    ai_get_move(&copy, &ai);
+    double seconds = now_seconds() - start;
+
+    const double first_rate = ai.stats.cutoffs
+                            ? 100.0 * ai.stats.first_cutoffs / ai.stats.cutoffs
+                            : 0;
+    printf(" %10lu nœuds %9lu coupures (%5.1f%% au 1er coup) %8.2f ms |",
+           ai.stats.nodes, ai.stats.cutoffs, first_rate, seconds * 1e3);
+    return ai.stats.nodes;
+}
+
+int main(int argc, char* argv[]) {
+    int width = 4, height = 4, win_length = 4;
+
+    if (argc == 4) {
+        width = atoi(argv[1]);
+        height = atoi(argv[2]);
+        win_length = atoi(argv[3]);
+    } else if (argc != 1) {
+        fprintf(stderr, "Usage : %s [largeur hauteur k]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const board_config_t* config = get_board_config(width, height, win_length);
+    if (!config) {
+        fprintf(stderr, "Plateau %dx%d, k=%d non supporté\n", width, height, win_length);
+        return EXIT_FAILURE;
+    }
+
+    game_t positions[POSITION_COUNT];
+    const char* names[POSITION_COUNT];
+    build_positions(config, positions, names);
+
+    printf("%dx%d, k=%d : sans tri | avec tri\n", width, height, win_length);
+
+    for (int p = 0; p < POSITION_COUNT; p++) {
+        printf("%-16s", names[p]);
+        const unsigned long plain_nodes = run(&positions[p], 0);
+        const unsigned long ordered_nodes = run(&positions[p], 1);
+        printf(" %+.0f%% nœuds\n", 100.0 * ((double)ordered_nodes / plain_nodes - 1.0));
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file bench_parallel.c
+ * @brief Accélération de la recherche du niveau difficile avec plusieurs threads
+ *
+ * Pour 1, 2, 4... threads (jusqu'au nombre de cœurs, ou au maximum
+ * demandé), lance la recherche à froid sur quelques positions et affiche
+ * le nombre de nœuds, le débit en nœuds par seconde et l'accélération par
+ * rapport à un seul thread.
+ *
+ * Usage : bench_parallel [largeur hauteur k [threads]] (4 4 4 par défaut)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../game.h"
+#include "../logic.h"
+#include "../ai.h"
+
+/** @brief Nombre de positions mesurées */
+#define POSITION_COUNT 4
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Prépare les positions mesurées : plateau vide, puis 1 à 3 coups joués
+ */
+static void build_positions(const board_config_t* config, game_t* positions) {
+    const int last_row = config->height - 1;
+    const int last_col = config->width - 1;
+
+    for (int p = 0; p < POSITION_COUNT; p++) {
+        positions[p] = (game_t){0};
+        positions[p].config = config;
+        reset_game(&positions[p]);
+    }
+
+    click_on_cell(&positions[1], last_row / 2, last_col / 2);
+
+    click_on_cell(&positions[2], 0, 0);
+
+    click_on_cell(&positions[3], 0, 0);
+    click_on_cell(&positions[3], last_row / 2, last_col / 2);
+    click_on_cell(&positions[3], last_row, last_col);
+}
+
+/**
+ * @brief Recherche à froid de toutes les positions avec thread_count threads
+ */
+static void run(const game_t* positions, int thread_count,
+                unsigned long* nodes, double* seconds) {
+    *nodes = 0;
+    *seconds = 0;
+
+    for (int p = 0; p < POSITION_COUNT; p++) {
+        ai_t ai;
+        game_t copy = positions[p];
+
+        // Table de transposition vide pour une mesure à froid
+        init_ai(&ai, HARD);
+        ai.thread_count = thread_count;
+        ai.time_limit_ms = 0;
+
+        double start = now_seconds();
+        ai_get_move(&copy, &ai);
+        *seconds += now_seconds() - start;
+        *nodes += ai.stats.nodes;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int width = 4, height = 4, win_length = 4;
+    int max_threads = ai_default_thread_count();
+
+    if (argc == 4 || argc == 5) {
+        width = atoi(argv[1]);
+        height = atoi(argv[2]);
+        win_length = atoi(argv[3]);
+        if (argc == 5) {
+            max_threads = atoi(argv[4]);
+        }
+    } else if (argc != 1) {
+        fprintf(stderr, "Usage : %s [largeur hauteur k [threads]]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const board_config_t* config = get_board_config(width, height, win_length);
+    if (!config || max_threads < 1 || max_threads > AI_MAX_THREADS) {
+        fprintf(stderr, "Paramètres non supportés\n");
+        return EXIT_FAILURE;
+    }
+
+    game_t positions[POSITION_COUNT];
+    build_positions(config, positions);
+
+    printf("%dx%d, k=%d, %d positions, %d cœurs\n", width, height, win_length,
+           POSITION_COUNT, ai_default_thread_count());
+
+    double reference_rate = 0;
+    double reference_time = 0;
+
+    for (int threads = 1; threads <= max_threads;) {
+        unsigned long nodes;
+        double seconds;
+        run(positions, threads, &nodes, &seconds);
+
+        const double rate = nodes / seconds;
+        if (threads == 1) {
+            reference_rate = rate;
+            reference_time = seconds;
+        }
+
+        printf("%3d threads %10lu nœuds %9.2f ms %7.2f Mnœuds/s | accélération x%.2f"
+               " (débit x%.2f)\n",
+               threads, nodes, seconds * 1e3, rate * 1e-6,
+               reference_time / seconds, rate / reference_rate);
+
+        // Dernier palier : exactement max_threads
+        if (threads < max_threads && threads * 2 > max_threads) {
+            threads = max_threads;
+        } else {
+            threads *= 2;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
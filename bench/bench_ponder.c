@@ -0,0 +1,174 @@
+/**
+ * @file bench_ponder.c
+ * @brief Temps de réponse de l'IA avec et sans réflexion pendant le tour adverse
+ *
+ * Depuis une position où le joueur X est au trait, mesure pour chacune de
+ * ses réponses le temps que met l'IA (joueur O, limites de temps par
+ * défaut) à répondre :
+ * - à froid, tables vides ;
+ * - après ai_ponder() sur la position de départ, interrompue comme dans
+ *   le jeu quand X joue, au bout d'un temps de réflexion humain.
+ * Au niveau expert, le temps de réponse est fixe : les simulations reprises
+ * de l'arbre de la réflexion montrent ce qu'elle a apporté.
+ *
+ * Usage : bench_ponder [largeur hauteur k [niveau [réflexion_ms]]]
+ *         (15 15 5, niveau difficile, 3000 ms de réflexion de X par défaut ;
+ *         niveau 44 pour EXPERT)
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../game.h"
+#include "../logic.h"
+#include "../ai.h"
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Initialise l'IA mesurée (tables vides, limites par défaut)
+ */
+static void setup_ai(ai_t* ai, AIDifficulty difficulty) {
+    init_ai(ai, difficulty);
+    ai->thread_count = 1;
+}
+
+/**
+ * @brief Temps de réponse de l'IA après la réponse reply de X
+ */
+static double response_time(const game_t* start, int reply, ai_t* ai) {
+    game_t game = *start;
+    click_on_cell(&game, reply / game.config->width, reply % game.config->width);
+
+    double begin = now_seconds();
+    ai_get_move(&game, ai);
+    return now_seconds() - begin;
+}
+
+/** @brief Interruption de la réflexion au bout du temps de réflexion de X */
+typedef struct {
+    atomic_int stop;
+    int think_ms;
+} think_timer_t;
+
+static void* think_timer(void* data) {
+    think_timer_t* timer = (think_timer_t*)data;
+    const struct timespec think = {timer->think_ms / 1000, (timer->think_ms % 1000) * 1000000L};
+    nanosleep(&think, NULL);
+    atomic_store(&timer->stop, 1);
+    return NULL;
+}
+
+/**
+ * @brief Fait réfléchir l'IA pendant think_ms, puis l'interrompt
+ *
+ * Comme dans le jeu, la réflexion tourne sur le thread qui répondra
+ * ensuite (les coups préparés lui sont propres) et s'arrête quand X joue.
+ */
+static void ponder_for(const game_t* start, ai_t* ai, int think_ms) {
+    think_timer_t timer = {.think_ms = think_ms};
+    atomic_init(&timer.stop, 0);
+    ai->stop_flag = &timer.stop;
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, think_timer, &timer);
+    game_t game = *start;
+    ai_ponder(&game, ai);
+    pthread_join(thread, NULL);
+
+    ai->stop_flag = NULL;
+}
+
+int main(int argc, char* argv[]) {
+    int width = 15, height = 15, win_length = 5;
+    AIDifficulty difficulty = HARD;
+    int think_ms = 3000;
+
+    if (argc >= 4 && argc <= 6) {
+        width = atoi(argv[1]);
+        height = atoi(argv[2]);
+        win_length = atoi(argv[3]);
+        if (argc >= 5) {
+            difficulty = (atoi(argv[4]) == EXPERT) ? EXPERT : HARD;
+        }
+        if (argc == 6) {
+            think_ms = atoi(argv[5]);
+        }
+    } else if (argc != 1) {
+        fprintf(stderr, "Usage : %s [largeur hauteur k [niveau [réflexion_ms]]]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const board_config_t* config = get_board_config(width, height, win_length);
+    if (!config || think_ms < 0) {
+        fprintf(stderr, "Paramètres non supportés\n");
+        return EXIT_FAILURE;
+    }
+
+    // Position de départ : X au centre, O à côté, X au trait
+    game_t start = {0};
+    start.config = config;
+    reset_game(&start);
+    start.is_ai_mode = 1;
+    click_on_cell(&start, height / 2, width / 2);
+    click_on_cell(&start, height / 2, width / 2 + 1);
+
+    // Réponses de X : toutes les cases voisines des pions
+    int replies[MAX_CELLS];
+    int reply_count = 0;
+    for (int i = 0; i < config->cell_count; i++) {
+        if (get_cell(&start, i) != EMPTY) {
+            continue;
+        }
+        for (int p = 0; p < 2; p++) {
+            bitboard_t near = bitboard_and(&config->neighborhood[i], &start.boards[p]);
+            if (!bitboard_is_empty(&near)) {
+                replies[reply_count++] = i;
+                break;
+            }
+        }
+    }
+
+    ai_t ai;
+    double cold = 0;
+    for (int r = 0; r < reply_count; r++) {
+        setup_ai(&ai, difficulty);
+        cold += response_time(&start, replies[r], &ai);
+    }
+
+    // Pour chaque réponse : réflexion interrompue au bout de think_ms, puis réponse
+    double warm = 0, warm_max = 0;
+    int prepared = 0;
+    unsigned long reused = 0, searched = 0;
+    for (int r = 0; r < reply_count; r++) {
+        setup_ai(&ai, difficulty);
+        ponder_for(&start, &ai, think_ms);
+        const double time = response_time(&start, replies[r], &ai);
+        warm += time;
+        warm_max = (time > warm_max) ? time : warm_max;
+        prepared += ai.stats.ponder_hit;
+        reused += ai.stats.reused_playouts;
+        searched += ai.stats.nodes;
+    }
+
+    printf("%dx%d, k=%d, %s, limites par défaut, %d ms de réflexion de X, %d réponses de X\n",
+           width, height, win_length, (difficulty == EXPERT) ? "expert" : "difficile",
+           think_ms, reply_count);
+    printf("réponses préparées %d/%d\n", prepared, reply_count);
+    printf("réponse à froid  %8.2f ms en moyenne\n", cold * 1e3 / reply_count);
+    printf("après réflexion  %8.2f ms en moyenne, %.2f ms au plus\n",
+           warm * 1e3 / reply_count, warm_max * 1e3);
+    if (difficulty == EXPERT) {
+        printf("simulations reprises %lu en moyenne, pour %lu pendant la réponse\n",
+               reused / reply_count, searched / reply_count);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file bench_snake.c
+ * @brief Coût d'un tick et d'une image du Snake selon la taille de la grille et du serpent
+ *
+ * Pour chaque grille carrée, fait grandir le serpent jusqu'à chaque longueur
+ * visée (une pomme posée devant la tête à chaque tick, le long d'un cycle
+ * qui passe par toutes les cases), puis mesure :
+ * - le nombre de ticks par seconde, le serpent suivant le même cycle sans
+ *   plus grandir ;
+ * - le temps d'une image dessinée par un renderer logiciel SDL, sans fenêtre.
+ *
+ * Usage : bench_snake [côté maximal]   (SNAKE_MAX_GRID_SIZE par défaut)
+ */
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <SDL2/SDL.h>
+
+#include "../snake.h"
+
+/** @brief Ticks mesurés par configuration */
+#define TICK_COUNT 2000000
+
+/** @brief Images mesurées par configuration */
+#define FRAME_COUNT 50
+
+/** @brief Taille de l'image dessinée (pixels) */
+#define FRAME_SIZE 800
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Direction qui suit un cycle passant par toutes les cases
+ *
+ * Lignes parcourues en serpentin de la colonne 1 à la dernière, retour
+ * par la colonne 0. La hauteur de la grille doit être paire.
+ */
+static SnakeDirection cycle_direction(const snake_game_t* game) {
+    const int x = game->body[game->head].x;
+    const int y = game->body[game->head].y;
+    const int width = game->config.width;
+    const int height = game->config.height;
+
+    if (x == 0) {
+        return (y == 0) ? SNAKE_RIGHT : SNAKE_UP;
+    }
+    if (y % 2 == 0) {
+        return (x < width - 1) ? SNAKE_RIGHT : SNAKE_DOWN;
+    }
+    if (x > 1) {
+        return SNAKE_LEFT;
+    }
+    return (y == height - 1) ? SNAKE_LEFT : SNAKE_DOWN;
+}
+
+/**
+ * @brief Avance d'un tick le long du cycle
+ * @param grow 1 pour poser la pomme sur la case suivante
+ */
+static void cycle_tick(snake_game_t* game, int grow) {
+    const SnakeDirection direction = cycle_direction(game);
+    if (grow) {
+        int x = game->body[game->head].x;
+        int y = game->body[game->head].y;
+        switch (direction) {
+            case SNAKE_UP:    y--; break;
+            case SNAKE_DOWN:  y++; break;
+            case SNAKE_LEFT:  x--; break;
+            case SNAKE_RIGHT: x++; break;
+        }
+        game->apple_x = x;
+        game->apple_y = y;
+    }
+    snake_step(game, direction);
+}
+
+int main(int argc, char* argv[]) {
+    int max_size = SNAKE_MAX_GRID_SIZE;
+    if (argc == 2) {
+        max_size = atoi(argv[1]);
+    } else if (argc != 1) {
+        fprintf(stderr, "Usage : %s [côté maximal]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, FRAME_SIZE, FRAME_SIZE, 32,
+                                                          SDL_PIXELFORMAT_ARGB8888);
+    SDL_Renderer* renderer = surface ? SDL_CreateSoftwareRenderer(surface) : NULL;
+    if (!renderer) {
+        fprintf(stderr, "Erreur renderer logiciel: %s\n", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+
+    static const int sizes[] = {64, 256, 1024, 4096};
+    static const int lengths[] = {10, 1000, 100000, 1000000};
+    const window_dimensions_t dimensions = {FRAME_SIZE, FRAME_SIZE, 0.0f, 0.0f};
+
+    printf("%-11s %9s %14s %12s\n", "grille", "longueur", "ticks/s", "image (ms)");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && sizes[s] <= max_size; s++) {
+        const snake_config_t config = {sizes[s], sizes[s], INT_MAX};
+        snake_t snake;
+        if (init_snake_game(&snake, &config, 0, 0, &dimensions, 1) < 0) {
+            fprintf(stderr, "Mémoire insuffisante pour une grille %dx%d\n", sizes[s], sizes[s]);
+            break;
+        }
+        snake_game_t* game = &snake.game;
+
+        for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+            // Au plus la moitié de la grille, pour laisser de la place aux pommes
+            if (lengths[l] > game->cell_count / 2) {
+                break;
+            }
+            while (game->length < lengths[l] && game->state == SNAKE_RUNNING) {
+                cycle_tick(game, 1);
+            }
+
+            // Pomme hors de la grille : la longueur ne change plus pendant la mesure
+            game->apple_x = -1;
+            game->apple_y = -1;
+
+            double begin = now_seconds();
+            for (int t = 0; t < TICK_COUNT && game->state == SNAKE_RUNNING; t++) {
+                cycle_tick(game, 0);
+            }
+            const double ticks = now_seconds() - begin;
+
+            begin = now_seconds();
+            for (int f = 0; f < FRAME_COUNT; f++) {
+                render_snake_game(renderer, &snake);
+            }
+            const double frames = now_seconds() - begin;
+
+            if (game->state != SNAKE_RUNNING) {
+                fprintf(stderr, "ERREUR : partie terminée (état %d)\n", game->state);
+                return EXIT_FAILURE;
+            }
+            printf("%5dx%-5d %9d %12.1f M %12.3f\n", sizes[s], sizes[s], game->length,
+                   TICK_COUNT / ticks * 1e-6, frames * 1e3 / FRAME_COUNT);
+        }
+
+        cleanup_snake(&snake);
+    }
+
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(surface);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/**
+ * @file bench_snake_sim.c
+ * @brief Débit du Snake sans fenêtre (snake_logic.h), piloté automatiquement
+ *
+ * Enchaîne des parties sur un seul cœur, chacune avec sa graine, sous deux
+ * pilotes automatiques :
+ * - hasard : une case libre voisine de la tête, au hasard ;
+ * - glouton : la case libre voisine la plus proche de la pomme.
+ * Affiche le nombre de ticks par seconde, le score moyen, la répartition
+ * des fins de partie et une empreinte des résultats : à paramètres égaux,
+ * une empreinte différente signale un changement de comportement des règles.
+ *
+ * Usage : bench_snake_sim [largeur hauteur score]   (20 20 400 par défaut :
+ *         la partie ne s'arrête qu'en remplissant la grille ou sur une collision)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../snake_logic.h"
+
+/** @brief Ticks joués par pilote */
+#define TICK_BUDGET 20000000L
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/** @brief Déplacement de chaque direction */
+static const int DIRECTION_DX[] = {[SNAKE_UP] = 0, [SNAKE_DOWN] = 0, [SNAKE_LEFT] = -1, [SNAKE_RIGHT] = 1};
+static const int DIRECTION_DY[] = {[SNAKE_UP] = -1, [SNAKE_DOWN] = 1, [SNAKE_LEFT] = 0, [SNAKE_RIGHT] = 0};
+
+/** @brief Pilote automatique : direction du prochain tick */
+typedef SnakeDirection (*snake_policy_t)(const snake_game_t* game, rng_t* rng);
+
+/**
+ * @brief Vérifie si la tête peut entrer dans la case voisine sans collision
+ */
+static int is_free_move(const snake_game_t* game, SnakeDirection direction) {
+    const int x = game->body[game->head].x + DIRECTION_DX[direction];
+    const int y = game->body[game->head].y + DIRECTION_DY[direction];
+    return x >= 0 && x < game->config.width && y >= 0 && y < game->config.height &&
+           !snake_is_occupied(game, x, y);
+}
+
+/**
+ * @brief Pilote aléatoire : une direction sans collision immédiate, au hasard
+ */
+static SnakeDirection random_policy(const snake_game_t* game, rng_t* rng) {
+    SnakeDirection moves[4];
+    int count = 0;
+    for (int d = SNAKE_UP; d <= SNAKE_RIGHT; d++) {
+        if (is_free_move(game, (SnakeDirection)d)) {
+            moves[count++] = (SnakeDirection)d;
+        }
+    }
+    return count ? moves[rng_below(rng, count)] : game->direction;
+}
+
+/**
+ * @brief Pilote glouton : la direction sans collision immédiate qui
+ * rapproche le plus de la pomme (distance de Manhattan)
+ */
+static SnakeDirection greedy_policy(const snake_game_t* game, rng_t* rng) {
+    (void)rng;
+    SnakeDirection best = game->direction;
+    int best_distance = -1;
+    for (int d = SNAKE_UP; d <= SNAKE_RIGHT; d++) {
+        if (!is_free_move(game, (SnakeDirection)d)) {
+            continue;
+        }
+        const int x = game->body[game->head].x + DIRECTION_DX[d];
+        const int y = game->body[game->head].y + DIRECTION_DY[d];
+        const int distance = abs(x - game->apple_x) + abs(y - game->apple_y);
+        if (best_distance < 0 || distance < best_distance) {
+            best = (SnakeDirection)d;
+            best_distance = distance;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Joue des parties jusqu'à TICK_BUDGET ticks et affiche leur bilan
+ */
+static void run_policy(const char* name, snake_policy_t policy, snake_game_t* game) {
+    long ticks = 0, games = 0, score_sum = 0;
+    long endings[SNAKE_FULL + 1] = {0};
+    uint64_t fingerprint = 0;
+    rng_t rng;
+    rng_seed(&rng, 1);
+
+    const double begin = now_seconds();
+    while (ticks < TICK_BUDGET) {
+        snake_game_reset(game, (uint64_t)games);
+        while (snake_step(game, policy(game, &rng)) == SNAKE_RUNNING) {
+            ticks++;
+        }
+        ticks++;
+
+        games++;
+        score_sum += game->score;
+        endings[game->state]++;
+        fingerprint = (fingerprint ^ (uint64_t)(game->score * 4 + game->state)) * 0x100000001B3ull;
+    }
+    const double elapsed = now_seconds() - begin;
+
+    printf("  %-10s %8ld %8.1f M %9.1f  %5.1f %% %5.1f %% %5.1f %%  %016llx\n", name, games,
+           ticks / elapsed * 1e-6, (double)score_sum / games,
+           100.0 * endings[SNAKE_WON] / games, 100.0 * endings[SNAKE_LOST] / games,
+           100.0 * endings[SNAKE_FULL] / games, (unsigned long long)fingerprint);
+}
+
+int main(int argc, char* argv[]) {
+    snake_config_t config = {20, 20, 400};
+    if (argc == 4) {
+        config.width = atoi(argv[1]);
+        config.height = atoi(argv[2]);
+        config.target_score = atoi(argv[3]);
+    } else if (argc != 1) {
+        fprintf(stderr, "Usage : %s [largeur hauteur score]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    snake_game_t game;
+    if (!snake_config_is_valid(&config) || snake_game_init(&game, &config, 0) < 0) {
+        fprintf(stderr, "Grille invalide (%d à %d cases de côté, score d'au moins 1)\n",
+                SNAKE_MIN_GRID_SIZE, SNAKE_MAX_GRID_SIZE);
+        return EXIT_FAILURE;
+    }
+
+    printf("%dx%d, score visé %d, %ld ticks par pilote sur un cœur\n", config.width,
+           config.height, config.target_score, TICK_BUDGET);
+    printf("  %-10s %8s %10s %9s  %7s %7s %7s  %s\n", "pilote", "parties", "ticks/s",
+           "score", "gagnées", "perdues", "pleines", "empreinte");
+    run_policy("hasard", random_policy, &game);
+    run_policy("glouton", greedy_policy, &game);
+
+    snake_game_free(&game);
+    return EXIT_SUCCESS;
+}
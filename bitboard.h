@@ -0,0 +1,149 @@
+/**
+ * @file bitboard.h
+ * @brief Ensembles de cases représentés par des masques de bits
+ *
+ * Un bitboard_t contient un bit par case du plus grand plateau supporté :
+ * le bit d'index BOARD_INDEX(config, row, col) vaut 1 si la case appartient
+ * à l'ensemble. Les bits au-delà du nombre de cases du plateau courant
+ * restent toujours à 0.
+ *
+ * Les fonctions sont déclarées static inline : elles sont appelées à
+ * chaque nœud de la recherche de l'IA.
+ */
+
+#ifndef BITBOARD_H_
+#define BITBOARD_H_
+
+#include <stdint.h>
+
+/** @brief Côté maximal du plateau */
+#define MAX_BOARD_SIZE 15
+
+/** @brief Nombre maximal de cases du plateau */
+#define MAX_CELLS (MAX_BOARD_SIZE * MAX_BOARD_SIZE)
+
+/** @brief Nombre de mots de 64 bits par bitboard */
+#define BITBOARD_WORDS ((MAX_CELLS + 63) / 64)
+
+/** @brief Ensemble de cases du plateau */
+typedef struct {
+    uint64_t words[BITBOARD_WORDS];
+} bitboard_t;
+
+/**
+ * @brief Vide un ensemble
+ */
+static inline void bitboard_clear_all(bitboard_t* bb) {
+    for (int w = 0; w < BITBOARD_WORDS; w++) {
+        bb->words[w] = 0;
+    }
+}
+
+/**
+ * @brief Teste la présence d'une case
+ */
+static inline int bitboard_test(const bitboard_t* bb, int index) {
+    return (int)((bb->words[index >> 6] >> (index & 63)) & 1);
+}
+
+/**
+ * @brief Ajoute une case
+ */
+static inline void bitboard_set(bitboard_t* bb, int index) {
+    bb->words[index >> 6] |= (uint64_t)1 << (index & 63);
+}
+
+/**
+ * @brief Retire une case
+ */
+static inline void bitboard_reset(bitboard_t* bb, int index) {
+    bb->words[index >> 6] &= ~((uint64_t)1 << (index & 63));
+}
+
+/**
+ * @brief Indique si l'ensemble est vide
+ */
+static inline int bitboard_is_empty(const bitboard_t* bb) {
+    uint64_t any = 0;
+    for (int w = 0; w < BITBOARD_WORDS; w++) {
+        any |= bb->words[w];
+    }
+    return any == 0;
+}
+
+/**
+ * @brief Nombre de cases de l'ensemble
+ */
+static inline int bitboard_count(const bitboard_t* bb) {
+    int count = 0;
+    for (int w = 0; w < BITBOARD_WORDS; w++) {
+        count += __builtin_popcountll(bb->words[w]);
+    }
+    return count;
+}
+
+/**
+ * @brief Retire et renvoie la case de plus petit index
+ * @return Index de la case, -1 si l'ensemble est vide
+ */
+static inline int bitboard_pop_lowest(bitboard_t* bb) {
+    for (int w = 0; w < BITBOARD_WORDS; w++) {
+        if (bb->words[w]) {
+            int bit = __builtin_ctzll(bb->words[w]);
+            bb->words[w] &= bb->words[w] - 1;
+            return (w << 6) | bit;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Cases présentes dans les deux ensembles
+ */
+static inline bitboard_t bitboard_and(const bitboard_t* a, const bitboard_t* b) {
+    bitboard_t result;
+    for (int w = 0; w < BITBOARD_WORDS; w++) {
+        result.words[w] = a->words[w] & b->words[w];
+    }
+    return result;
+}
+
+/**
+ * @brief Ajoute à a les cases de b
+ */
+static inline void bitboard_or_assign(bitboard_t* a, const bitboard_t* b) {
+    for (int w = 0; w < BITBOARD_WORDS; w++) {
+        a->words[w] |= b->words[w];
+    }
+}
+
+/**
+ * @brief Cases de mask absentes de a et b (cases vides de mask)
+ */
+static inline bitboard_t bitboard_free(const bitboard_t* a, const bitboard_t* b,
+                                       const bitboard_t* mask) {
+    bitboard_t result;
+    for (int w = 0; w < BITBOARD_WORDS; w++) {
+        result.words[w] = ~(a->words[w] | b->words[w]) & mask->words[w];
+    }
+    return result;
+}
+
+/**
+ * @brief Décale l'ensemble vers les petits index
+ *
+ * Le bit i du résultat vaut le bit i + shift de l'entrée.
+ *
+ * @param bb Ensemble à décaler
+ * @param shift Décalage, compris entre 1 et 63
+ */
+static inline bitboard_t bitboard_shift_down(const bitboard_t* bb, int shift) {
+    bitboard_t result;
+    for (int w = 0; w < BITBOARD_WORDS - 1; w++) {
+        result.words[w] = (bb->words[w] >> shift) | (bb->words[w + 1] << (64 - shift));
+    }
+    result.words[BITBOARD_WORDS - 1] = bb->words[BITBOARD_WORDS - 1] >> shift;
+    return result;
+}
+
+#endif  /* BITBOARD_H_ */
@@ -5,41 +5,117 @@
  * Ce fichier contient les constantes, énumérations et structures de base
  * utilisées dans l'ensemble du projet. Il définit la configuration du jeu,
  * les états possibles, et la structure principale maintenant l'état du jeu.
+ *
+ * Il ne dépend pas de SDL : les règles et l'IA (bibliothèque ttt_core)
+ * s'utilisent sans fenêtre. L'état propre à l'affichage (dimensions,
+ * boutons, temporisation) est dans game_ui_t (window.h).
  */
 
 #ifndef GAME_H_
 #define GAME_H_
 
-#include <SDL2/SDL.h>
+#include <stdint.h>
+#include "./bitboard.h"
 
 /*********************************
  * Configuration de la grille
  *********************************/
-/** @brief Taille de la grille (3x3 pour un morpion standard) */
-#define N 3
+/** @brief Plateau par défaut (morpion standard 3x3, 3 symboles alignés) */
+#define DEFAULT_BOARD_WIDTH 3
+#define DEFAULT_BOARD_HEIGHT 3
+#define DEFAULT_WIN_LENGTH 3
 
-/*********************************
- * Configuration de l'affichage
- *********************************/
-/** @brief Largeur de la fenêtre de jeu en pixels */
-#define SCREEN_WIDTH 640.0
-/** @brief Hauteur de la fenêtre de jeu en pixels */
-#define SCREEN_HEIGHT 480.0
-#define MIN_WINDOW_SIZE 300
+/** @brief Taille minimale du côté du plateau et de l'alignement gagnant */
+#define MIN_BOARD_SIZE 3
+
+/** @brief Nombre maximal de symétries d'un plateau (carré) */
+#define MAX_SYMMETRIES 8
+
+/** @brief Nombre maximal de lignes gagnantes sur un plateau d'au plus 64 cases */
+#define MAX_SMALL_LINES 256
+
+/** @brief Nombre de directions d'alignement (horizontale, verticale, 2 diagonales) */
+#define DIRECTION_COUNT 4
+
+/** @brief Nombre maximal de lignes gagnantes (segments de win_length cases) */
+#define MAX_LINES (DIRECTION_COUNT * MAX_CELLS)
 
+/** @brief Nombre maximal de lignes gagnantes passant par une même case */
+#define MAX_LINES_PER_CELL (DIRECTION_COUNT * MAX_BOARD_SIZE)
 
-// /** @brief Largeur d'une cellule de la grille */
-// #define CELL_WIDTH (SCREEN_WIDTH / N)
-// /** @brief Hauteur d'une cellule de la grille */
-// #define CELL_HEIGHT (SCREEN_HEIGHT / N)
+/** @brief Distance (en lignes et en colonnes) couverte par board_config_t.neighborhood */
+#define NEIGHBORHOOD_DISTANCE 2
 
+/**
+ * @brief Variantes de plateau disposant d'un chemin de vérification dédié
+ */
+typedef enum {
+    BOARD_KIND_GENERIC = 0,  /**< Plateau quelconque, vérification par décalages */
+    BOARD_KIND_SMALL = 1,    /**< Au plus 64 cases, masques sur un seul mot */
+    BOARD_KIND_3X3 = 2,      /**< Morpion classique 3x3, 3 alignés */
+    BOARD_KIND_4X4 = 3,      /**< 4x4, 4 alignés */
+    BOARD_KIND_15X15 = 4     /**< Gomoku 15x15, 5 alignés */
+} BoardKind;
+
+/**
+ * @brief Configuration (m,n,k) du plateau et tables dérivées
+ *
+ * Une configuration est construite une seule fois par get_board_config()
+ * puis partagée en lecture seule par toutes les parties qui l'utilisent.
+ */
 typedef struct {
-    int window_width;
-    int window_height;
-    float cell_width;
-    float cell_height;
-} window_dimensions_t;
+    int width;        /**< Nombre de colonnes */
+    int height;       /**< Nombre de lignes */
+    int win_length;   /**< Nombre de symboles à aligner pour gagner */
+    int cell_count;   /**< width * height */
+    BoardKind kind;   /**< Chemin de vérification à utiliser */
+
+    /** @brief Toutes les cases du plateau */
+    bitboard_t full_mask;
+
+    /** @brief Masques des lignes gagnantes (plateaux d'au plus 64 cases) */
+    uint64_t small_lines[MAX_SMALL_LINES];
+    int small_line_count;
+
+    /**
+     * @brief Décalage entre deux cases consécutives pour chaque direction
+     * et cases d'où peut partir un alignement complet dans cette direction
+     */
+    int direction_steps[DIRECTION_COUNT];
+    bitboard_t direction_starts[DIRECTION_COUNT];
+
+    /**
+     * @brief Lignes gagnantes : tous les segments de win_length cases
+     * La ligne l part de la case line_starts[l] dans la direction
+     * line_directions[l] ; cell_lines[i] liste les lignes contenant la case i.
+     */
+    int line_count;
+    int16_t line_starts[MAX_LINES];
+    uint8_t line_directions[MAX_LINES];
+    uint8_t cell_line_count[MAX_CELLS];
+    int16_t cell_lines[MAX_CELLS][MAX_LINES_PER_CELL];
+
+    /**
+     * @brief Symétries du plateau (8 pour un carré, 4 sinon)
+     * symmetry_map[t][i] est l'image de la case i par la symétrie t,
+     * symmetry_inverse[t] la transformation réciproque ; t = 0 est l'identité.
+     */
+    int symmetry_count;
+    int16_t symmetry_map[MAX_SYMMETRIES][MAX_CELLS];
+    int16_t symmetry_inverse[MAX_SYMMETRIES][MAX_CELLS];
+
+    /**
+     * @brief Voisinage de chaque case : cases distinctes à au plus
+     * NEIGHBORHOOD_DISTANCE lignes et colonnes
+     */
+    bitboard_t neighborhood[MAX_CELLS];
+} board_config_t;
 
+/*********************************
+ * Représentation du plateau
+ *********************************/
+/** @brief Index du masque d'un joueur dans game_t.boards */
+#define PLAYER_INDEX(player) ((player) - 1)
 
 /*********************************
  * Configuration du timing
@@ -78,6 +154,17 @@ typedef enum {
     VICTORY_MENU_STATE = 4, /**< Menu de fin de partie */
 } GameState;
 
+/*********************************
+ * Historique des coups
+ *********************************/
+/**
+ * @brief Coup enregistré dans l'historique d'une partie
+ */
+typedef struct {
+    int16_t cell;    /**< Case jouée */
+    int16_t player;  /**< Joueur qui l'a jouée (PLAYER_X ou PLAYER_O) */
+} move_record_t;
+
 /*********************************
  * Structure principale du jeu
  *********************************/
@@ -88,8 +175,46 @@ typedef enum {
  * pour représenter l'état complet d'une partie à un instant donné
  */
 typedef struct {
-    /** @brief Plateau de jeu (tableau 1D représentant une grille 2D) */
-    int board[N * N];
+    /** @brief Dimensions et règles du plateau (partagées, lecture seule) */
+    const board_config_t* config;
+
+    /**
+     * @brief Plateau de jeu sous forme de deux masques de bits
+     * boards[PLAYER_INDEX(PLAYER_X)] pour X, boards[PLAYER_INDEX(PLAYER_O)] pour O
+     */
+    bitboard_t boards[2];
+
+    /**
+     * @brief Nombre de symboles de chaque joueur sur chaque ligne gagnante
+     * Tenu à jour par make_move() / unmake_move() : une ligne dont le
+     * compteur atteint win_length est complète.
+     */
+    uint8_t line_counts[2][MAX_LINES];
+
+    /** @brief Nombre de cases vides */
+    int empty_count;
+
+    /** @brief Dernière case jouée, -1 en début de partie */
+    int last_move;
+
+    /**
+     * @brief Résultat de la partie, figé à la fin de celle-ci
+     * winner vaut PLAYER_X ou PLAYER_O après une victoire, EMPTY sinon ;
+     * winning_cells liste alors les win_length cases de la ligne gagnante.
+     */
+    int winner;
+    int16_t winning_cells[MAX_BOARD_SIZE];
+    int winning_cell_count;
+
+    /**
+     * @brief Historique des coups joués, de taille fixe (aucune allocation)
+     * history[0 .. move_count - 1] sont les coups sur le plateau ;
+     * history[move_count .. move_count + redo_count - 1] sont les coups
+     * annulés qui peuvent être rejoués, oubliés dès qu'un autre coup est joué.
+     */
+    move_record_t history[MAX_CELLS];
+    int move_count;
+    int redo_count;
     
     /** @brief Joueur actif (PLAYER_X ou PLAYER_O) */
     int player;
@@ -97,18 +222,6 @@ typedef struct {
     /** @brief État actuel du jeu */
     GameState state;
     
-    /** 
-     * @brief Horodatage de la victoire
-     * Utilisé pour la temporisation de l'affichage de fin de partie
-     */
-    Uint32 victory_time;
-    
-    /** @brief Zone cliquable pour le bouton "Rejouer" */
-    SDL_Rect replay_button;
-    
-    /** @brief Zone cliquable pour le bouton "Menu principal" */
-    SDL_Rect menu_button;
-    
     /** 
      * @brief Mode de jeu actif
      * true = mode Snake, false = mode classique
@@ -120,9 +233,6 @@ typedef struct {
      * true = partie contre l'IA, false = partie JcJ
      */
     int is_ai_mode;
-
-    int is_fullscreen;
-    window_dimensions_t dimensions;
 } game_t;
 
 /*********************************
@@ -130,18 +240,21 @@ typedef struct {
  *********************************/
 /**
  * @brief Convertit des coordonnées 2D en index 1D
+ * @param config Configuration du plateau
  * @param row Numéro de ligne
  * @param col Numéro de colonne
- * @return Index dans le tableau board[]
+ * @return Index de la case (position du bit dans un bitboard_t)
  */
-#define BOARD_INDEX(row, col) ((row) * N + (col))
+#define BOARD_INDEX(config, row, col) ((row) * (config)->width + (col))
 
 /**
  * @brief Vérifie si des coordonnées sont valides
+ * @param config Configuration du plateau
  * @param row Numéro de ligne
  * @param col Numéro de colonne
  * @return true si les coordonnées sont dans la grille
  */
-#define IS_VALID_CELL(row, col) ((row) >= 0 && (row) < N && (col) >= 0 && (col) < N)
+#define IS_VALID_CELL(config, row, col) \
+    ((row) >= 0 && (row) < (config)->height && (col) >= 0 && (col) < (config)->width)
 
 #endif  /* GAME_H_ */
\ No newline at end of file
@@ -3,38 +3,276 @@
  * @brief Implémentation de la logique métier du jeu Tic-Tac-Toe
  */
 
+#include <string.h>
 #include "./game.h"
 #include "./logic.h"
 
+/*********************************
+ * Configurations du plateau
+ *********************************/
+
+/** @brief Nombre maximal de configurations différentes utilisées par le programme */
+#define BOARD_CONFIG_CACHE_SIZE 16
+
+static board_config_t config_cache[BOARD_CONFIG_CACHE_SIZE];
+static int config_cache_count = 0;
+
+/** @brief Lignes gagnantes du morpion 3x3 : 3 lignes, 3 colonnes, 2 diagonales */
+static const uint64_t LINES_3X3[] = {
+    0x007, 0x038, 0x1C0,
+    0x049, 0x092, 0x124,
+    0x111, 0x054
+};
+
+/** @brief Lignes gagnantes du 4x4 à 4 alignés */
+static const uint64_t LINES_4X4[] = {
+    0x000F, 0x00F0, 0x0F00, 0xF000,
+    0x1111, 0x2222, 0x4444, 0x8888,
+    0x8421, 0x1248
+};
+
+/** @brief Déplacement (ligne, colonne) associé à chaque direction */
+static const int DIRECTION_ROWS[DIRECTION_COUNT] = {0, 1, 1, 1};
+static const int DIRECTION_COLS[DIRECTION_COUNT] = {1, 0, 1, -1};
+
+/**
+ * @brief Symétries utilisées : toutes pour un carré, celles qui
+ * conservent les dimensions (identité, demi-tour, miroirs) sinon
+ */
+static const int SQUARE_SYMMETRIES[] = {0, 1, 2, 3, 4, 5, 6, 7};
+static const int RECTANGLE_SYMMETRIES[] = {0, 2, 4, 5};
+
+/**
+ * @brief Calcule l'image d'une case par une symétrie du plateau
+ *
+ * Les rotations d'un quart de tour et les symétries diagonales (1, 3, 6, 7)
+ * ne sont valides que pour un plateau carré.
+ *
+ * @param config Configuration du plateau
+ * @param transform Identifiant de la symétrie (0 à 7)
+ * @param row Ligne de la case
+ * @param col Colonne de la case
+ * @return Index de la case image
+ */
+static int transform_cell(const board_config_t* config, int transform, int row, int col) {
+    const int last_row = config->height - 1;
+    const int last_col = config->width - 1;
+
+    switch (transform) {
+        case 1:  return BOARD_INDEX(config, col, last_col - row);             // Rotation 90°
+        case 2:  return BOARD_INDEX(config, last_row - row, last_col - col);  // Rotation 180°
+        case 3:  return BOARD_INDEX(config, last_col - col, row);             // Rotation 270°
+        case 4:  return BOARD_INDEX(config, row, last_col - col);             // Miroir vertical
+        case 5:  return BOARD_INDEX(config, last_row - row, col);             // Miroir horizontal
+        case 6:  return BOARD_INDEX(config, col, row);                        // Diagonale principale
+        case 7:  return BOARD_INDEX(config, last_col - col, last_row - row);  // Diagonale secondaire
+        default: return BOARD_INDEX(config, row, col);                        // Identité
+    }
+}
+
+/**
+ * @brief Construit les tables dérivées d'une configuration (m,n,k)
+ */
+static void build_board_config(board_config_t* config, int width, int height, int win_length) {
+    config->width = width;
+    config->height = height;
+    config->win_length = win_length;
+    config->cell_count = width * height;
+
+    bitboard_clear_all(&config->full_mask);
+    for (int i = 0; i < config->cell_count; i++) {
+        bitboard_set(&config->full_mask, i);
+    }
+
+    // Départs d'alignement et lignes gagnantes
+    config->small_line_count = 0;
+    config->line_count = 0;
+    for (int i = 0; i < config->cell_count; i++) {
+        config->cell_line_count[i] = 0;
+    }
+
+    for (int d = 0; d < DIRECTION_COUNT; d++) {
+        config->direction_steps[d] = DIRECTION_ROWS[d] * width + DIRECTION_COLS[d];
+        bitboard_clear_all(&config->direction_starts[d]);
+
+        for (int row = 0; row < height; row++) {
+            for (int col = 0; col < width; col++) {
+                int end_row = row + (win_length - 1) * DIRECTION_ROWS[d];
+                int end_col = col + (win_length - 1) * DIRECTION_COLS[d];
+                if (!IS_VALID_CELL(config, end_row, end_col)) {
+                    continue;
+                }
+
+                int start = BOARD_INDEX(config, row, col);
+                bitboard_set(&config->direction_starts[d], start);
+
+                int line = config->line_count++;
+                config->line_starts[line] = (int16_t)start;
+                config->line_directions[line] = (uint8_t)d;
+                for (int i = 0; i < win_length; i++) {
+                    int cell = start + i * config->direction_steps[d];
+                    config->cell_lines[cell][config->cell_line_count[cell]++] = (int16_t)line;
+                }
+
+                if (config->cell_count <= 64) {
+                    uint64_t mask = 0;
+                    for (int i = 0; i < win_length; i++) {
+                        mask |= (uint64_t)1 << (start + i * config->direction_steps[d]);
+                    }
+                    config->small_lines[config->small_line_count++] = mask;
+                }
+            }
+        }
+    }
+
+    // Chemin de vérification
+    if (width == 3 && height == 3 && win_length == 3) {
+        config->kind = BOARD_KIND_3X3;
+    } else if (width == 4 && height == 4 && win_length == 4) {
+        config->kind = BOARD_KIND_4X4;
+    } else if (width == 15 && height == 15 && win_length == 5) {
+        config->kind = BOARD_KIND_15X15;
+    } else if (config->cell_count <= 64) {
+        config->kind = BOARD_KIND_SMALL;
+    } else {
+        config->kind = BOARD_KIND_GENERIC;
+    }
+
+    // Symétries
+    const int* symmetries = (width == height) ? SQUARE_SYMMETRIES : RECTANGLE_SYMMETRIES;
+    config->symmetry_count = (width == height) ? 8 : 4;
+
+    for (int t = 0; t < config->symmetry_count; t++) {
+        for (int i = 0; i < config->cell_count; i++) {
+            int image = transform_cell(config, symmetries[t], i / width, i % width);
+            config->symmetry_map[t][i] = (int16_t)image;
+            config->symmetry_inverse[t][image] = (int16_t)i;
+        }
+    }
+
+    // Voisinages
+    for (int i = 0; i < config->cell_count; i++) {
+        const int row = i / width;
+        const int col = i % width;
+
+        bitboard_clear_all(&config->neighborhood[i]);
+        for (int dr = -NEIGHBORHOOD_DISTANCE; dr <= NEIGHBORHOOD_DISTANCE; dr++) {
+            for (int dc = -NEIGHBORHOOD_DISTANCE; dc <= NEIGHBORHOOD_DISTANCE; dc++) {
+                if ((dr || dc) && IS_VALID_CELL(config, row + dr, col + dc)) {
+                    bitboard_set(&config->neighborhood[i], BOARD_INDEX(config, row + dr, col + dc));
+                }
+            }
+        }
+    }
+}
+
+/*********************************
+ * Détection des alignements
+ *********************************/
+
+/**
+ * @brief Cherche une ligne gagnante complète sur un plateau d'au plus 64 cases
+ */
+static inline CheckResult check_small_lines(uint64_t stones, const uint64_t* lines, int count) {
+    for (int i = 0; i < count; ++i) {
+        if ((stones & lines[i]) == lines[i]) {
+            return CHECK_TRUE;
+        }
+    }
+    return CHECK_FALSE;
+}
+
+/**
+ * @brief Cherche win_length symboles alignés par décalages successifs
+ *
+ * Dans chaque direction, on garde les cases c telles que c, c + pas, ...,
+ * c + (win_length - 1) * pas appartiennent au joueur, puis on ne retient
+ * que les départs valides (pas de débordement d'une ligne sur l'autre).
+ * Déclarée inline pour que les appels avec des dimensions constantes
+ * soient spécialisés par le compilateur.
+ */
+static inline CheckResult check_alignments(const bitboard_t* stones,
+                                           const board_config_t* config,
+                                           int width, int win_length) {
+    const int steps[DIRECTION_COUNT] = {1, width, width + 1, width - 1};
+
+    for (int d = 0; d < DIRECTION_COUNT; d++) {
+        bitboard_t run = *stones;
+
+        for (int i = 1; i < win_length && !bitboard_is_empty(&run); i++) {
+            bitboard_t shifted = bitboard_shift_down(&run, steps[d]);
+            run = bitboard_and(stones, &shifted);
+        }
+
+        run = bitboard_and(&run, &config->direction_starts[d]);
+        if (!bitboard_is_empty(&run)) {
+            return CHECK_TRUE;
+        }
+    }
+
+    return CHECK_FALSE;
+}
+
 /*********************************
  * Fonctions statiques internes
  *********************************/
 
 /**
- * @brief Vérifie les conditions de fin de partie
+ * @brief Mémorise le vainqueur et les cases de sa ligne gagnante
+ *
+ * La ligne est cherchée parmi celles qui passent par le dernier coup.
+ *
+ * @param game Pointeur vers l'état du jeu
+ * @param player Joueur qui vient de gagner
+ */
+static void store_winning_line(game_t* game, int player) {
+    const board_config_t* config = game->config;
+    const int cell = game->last_move;
+    const uint8_t* counts = game->line_counts[PLAYER_INDEX(player)];
+
+    game->winner = player;
+
+    for (int i = 0; i < config->cell_line_count[cell]; i++) {
+        const int line = config->cell_lines[cell][i];
+        if (counts[line] < config->win_length) {
+            continue;
+        }
+
+        const int start = config->line_starts[line];
+        const int step = config->direction_steps[config->line_directions[line]];
+        for (int j = 0; j < config->win_length; j++) {
+            game->winning_cells[j] = (int16_t)(start + j * step);
+        }
+        game->winning_cell_count = config->win_length;
+        return;
+    }
+}
+
+/**
+ * @brief Vérifie les conditions de fin de partie après un coup
  * 
  * Détermine si :
- * - Un joueur a gagné
+ * - Le joueur qui vient de jouer a gagné
  * - Il y a match nul
  * - La partie continue
  *
+ * Seules les lignes passant par le dernier coup peuvent avoir changé :
+ * make_move() a déjà mis leurs compteurs à jour. En cas de victoire, le
+ * résultat est mis en cache dans game->winner et game->winning_cells.
+ *
  * @param game Pointeur vers l'état du jeu
+ * @param player Joueur qui vient de jouer
+ * @param won Résultat de make_move() pour ce coup
  */
-static void check_game_over_condition(game_t* game) {
-    // Vérifie d'abord si X a gagné
-    if (check_player_won(game, PLAYER_X)) {
-        game->state = PLAYER_X_WON_STATE;
-        return;
-    }
-    
-    // Puis si O a gagné
-    if (check_player_won(game, PLAYER_O)) {
-        game->state = PLAYER_O_WON_STATE;
+static void check_game_over_condition(game_t* game, int player, CheckResult won) {
+    if (won) {
+        game->state = (player == PLAYER_X) ? PLAYER_X_WON_STATE : PLAYER_O_WON_STATE;
+        store_winning_line(game, player);
         return;
     }
     
-    // Enfin, vérifie s'il y a match nul
-    if (count_cells(game->board, EMPTY) == 0) {
+    // Plateau plein sans alignement : match nul
+    if (game->empty_count == 0) {
         game->state = TIE_STATE;
     }
 }
@@ -48,18 +286,35 @@ static void check_game_over_condition(game_t* game) {
  */
 static CheckResult is_valid_move(const game_t* game, int row, int col) {
     // Vérifie que les coordonnées sont dans la grille
-    if (!IS_VALID_CELL(row, col)) {
+    if (!IS_VALID_CELL(game->config, row, col)) {
         return CHECK_FALSE;
     }
     
     // Vérifie que la case est vide
-    if (game->board[BOARD_INDEX(row, col)] != EMPTY) {
+    if (get_cell(game, BOARD_INDEX(game->config, row, col)) != EMPTY) {
         return CHECK_FALSE;
     }
     
     return CHECK_TRUE;
 }
 
+/**
+ * @brief Joue une case vide pour le joueur actif et l'ajoute à l'historique
+ */
+static void play_cell(game_t* game, int cell) {
+    // Place le symbole du joueur actuel
+    const int player = game->player;
+    CheckResult won = make_move(game, cell, player);
+    game->last_move = cell;
+    game->history[game->move_count].cell = (int16_t)cell;
+    game->history[game->move_count].player = (int16_t)player;
+    game->move_count++;
+    
+    // Change de joueur et vérifie la fin de partie
+    switch_player(game);
+    check_game_over_condition(game, player, won);
+}
+
 /*********************************
  * Implémentation des fonctions publiques
  *********************************/
@@ -68,18 +323,51 @@ void switch_player(game_t* game) {
     game->player = (game->player == PLAYER_X) ? PLAYER_O : PLAYER_X;
 }
 
+void skip_turn(game_t* game) {
+    game->redo_count = 0;
+    switch_player(game);
+}
+
 void player_turn(game_t* game, int row, int column) {
     // Vérifie si le coup est valide
     if (!is_valid_move(game, row, column)) {
         return;
     }
     
-    // Place le symbole du joueur actuel
-    game->board[BOARD_INDEX(row, column)] = game->player;
-    
-    // Change de joueur et vérifie la fin de partie
-    switch_player(game);
-    check_game_over_condition(game);
+    // Un nouveau coup oublie les coups annulés
+    game->redo_count = 0;
+    play_cell(game, BOARD_INDEX(game->config, row, column));
+}
+
+int undo_move(game_t* game) {
+    if (game->move_count == 0) {
+        return 0;
+    }
+
+    const move_record_t move = game->history[--game->move_count];
+    game->redo_count++;
+    unmake_move(game, move.cell, move.player);
+
+    // Le joueur qui avait posé ce symbole rejoue, la partie reprend
+    game->player = move.player;
+    game->state = RUNNING_STATE;
+    game->winner = EMPTY;
+    game->winning_cell_count = 0;
+    game->last_move = (game->move_count > 0) ? game->history[game->move_count - 1].cell : -1;
+    return 1;
+}
+
+int redo_move(game_t* game) {
+    if (game->redo_count == 0) {
+        return 0;
+    }
+
+    // history[move_count] est réécrit à l'identique par play_cell()
+    const move_record_t move = game->history[game->move_count];
+    game->redo_count--;
+    game->player = move.player;
+    play_cell(game, move.cell);
+    return 1;
 }
 
 void click_on_cell(game_t* game, int row, int column) {
@@ -95,7 +383,6 @@ void reset_game(game_t* game) {
     // Réinitialise l'état du jeu
     game->player = PLAYER_X;  // X commence toujours
     game->state = RUNNING_STATE;
-    game->victory_time = 0;
     
     // En mode IA, désactive le mode snake
     if (game->is_ai_mode) {
@@ -103,67 +390,78 @@ void reset_game(game_t* game) {
     }
     
     // Vide toutes les cases
-    for (int i = 0; i < N * N; ++i) {
-        game->board[i] = EMPTY;
-    }
-}
+    bitboard_clear_all(&game->boards[PLAYER_INDEX(PLAYER_X)]);
+    bitboard_clear_all(&game->boards[PLAYER_INDEX(PLAYER_O)]);
+    memset(game->line_counts, 0, sizeof(game->line_counts));
+    game->empty_count = game->config->cell_count;
+    game->last_move = -1;
+    game->move_count = 0;
+    game->redo_count = 0;
 
-CheckResult check_player_won(const game_t* game, int player) {
-    int row_count;     // Compteur pour les lignes
-    int column_count;  // Compteur pour les colonnes
-    int diag1_count;   // Compteur pour la diagonale principale
-    int diag2_count;   // Compteur pour la diagonale secondaire
-
-    // Réinitialise les compteurs de diagonales
-    diag1_count = 0;
-    diag2_count = 0;
-
-    // Vérifie les lignes et colonnes
-    for (int i = 0; i < N; ++i) {
-        // Réinitialise les compteurs pour chaque ligne/colonne
-        row_count = 0;
-        column_count = 0;
-        
-        for (int j = 0; j < N; ++j) {
-            // Vérifie la ligne i
-            if (game->board[BOARD_INDEX(i, j)] == player) {
-                row_count++;
-            }
-
-            // Vérifie la colonne i
-            if (game->board[BOARD_INDEX(j, i)] == player) {
-                column_count++;
-            }
-        }
+    // Aucun résultat
+    game->winner = EMPTY;
+    game->winning_cell_count = 0;
+}
 
-        // Si une ligne ou colonne est complète
-        if (row_count >= N || column_count >= N) {
-            return CHECK_TRUE;
-        }
+const board_config_t* get_board_config(int width, int height, int win_length) {
+    if (width < MIN_BOARD_SIZE || width > MAX_BOARD_SIZE ||
+        height < MIN_BOARD_SIZE || height > MAX_BOARD_SIZE ||
+        win_length < MIN_BOARD_SIZE ||
+        (win_length > width && win_length > height)) {
+        return NULL;
+    }
 
-        // Vérifie les diagonales
-        if (game->board[BOARD_INDEX(i, i)] == player) {
-            diag1_count++;
+    // Configuration déjà construite
+    for (int i = 0; i < config_cache_count; i++) {
+        const board_config_t* config = &config_cache[i];
+        if (config->width == width && config->height == height &&
+            config->win_length == win_length) {
+            return config;
         }
+    }
 
-        if (game->board[BOARD_INDEX(i, N - i - 1)] == player) {
-            diag2_count++;
-        }
+    if (config_cache_count == BOARD_CONFIG_CACHE_SIZE) {
+        return NULL;
     }
 
-    // Retourne vrai si une diagonale est complète
-    return (diag1_count >= N || diag2_count >= N) ? CHECK_TRUE : CHECK_FALSE;
+    board_config_t* config = &config_cache[config_cache_count++];
+    build_board_config(config, width, height, win_length);
+    return config;
 }
 
-int count_cells(const int* board, int cell_type) {
-    int count = 0;
+CheckResult check_player_won(const game_t* game, int player) {
+    const board_config_t* config = game->config;
+    const bitboard_t* stones = &game->boards[PLAYER_INDEX(player)];
+
+    switch (config->kind) {
+        case BOARD_KIND_3X3:
+            return check_small_lines(stones->words[0], LINES_3X3, 8);
+        case BOARD_KIND_4X4:
+            return check_small_lines(stones->words[0], LINES_4X4, 10);
+        case BOARD_KIND_SMALL:
+            return check_small_lines(stones->words[0], config->small_lines,
+                                     config->small_line_count);
+        case BOARD_KIND_15X15:
+            return check_alignments(stones, config, 15, 5);
+        default:
+            return check_alignments(stones, config, config->width, config->win_length);
+    }
+}
 
-    // Parcourt toutes les cellules
-    for (int i = 0; i < N * N; ++i) {
-        if (board[i] == cell_type) {
-            count++;
+int count_cells(const game_t* game, int cell_type) {
+    // Jusqu'à 8x8, tout le plateau tient dans le premier mot
+    if (game->config->cell_count <= 64) {
+        const uint64_t occupied = game->boards[0].words[0] | game->boards[1].words[0];
+        if (cell_type == EMPTY) {
+            return __builtin_popcountll(~occupied & game->config->full_mask.words[0]);
         }
+        return __builtin_popcountll(game->boards[PLAYER_INDEX(cell_type)].words[0]);
+    }
+
+    if (cell_type == EMPTY) {
+        bitboard_t empty = empty_cells(game);
+        return bitboard_count(&empty);
     }
 
-    return count;
-}
\ No newline at end of file
+    return bitboard_count(&game->boards[PLAYER_INDEX(cell_type)]);
+}
@@ -23,6 +23,127 @@ typedef enum {
     CHECK_TRUE = 1
 } CheckResult;
 
+/*********************************
+ * Configuration du plateau
+ *********************************/
+
+/**
+ * @brief Renvoie la configuration d'un plateau (m,n,k)
+ *
+ * Les tables de la configuration (lignes gagnantes, symétries...) sont
+ * construites au premier appel puis réutilisées. Les configurations
+ * renvoyées ne sont jamais modifiées ni libérées.
+ *
+ * @param width Nombre de colonnes (MIN_BOARD_SIZE à MAX_BOARD_SIZE)
+ * @param height Nombre de lignes (MIN_BOARD_SIZE à MAX_BOARD_SIZE)
+ * @param win_length Nombre de symboles à aligner (MIN_BOARD_SIZE au plus grand côté)
+ * @return Configuration partagée, NULL si les paramètres sont invalides
+ */
+const board_config_t* get_board_config(int width, int height, int win_length);
+
+/*********************************
+ * Accès au plateau
+ *********************************/
+
+/**
+ * @brief Renvoie le contenu d'une case
+ * @param game Pointeur vers l'état du jeu
+ * @param index Index de la case (voir BOARD_INDEX)
+ * @return EMPTY, PLAYER_X ou PLAYER_O
+ */
+static inline CellState get_cell(const game_t* game, int index) {
+    if (bitboard_test(&game->boards[PLAYER_INDEX(PLAYER_X)], index)) return PLAYER_X;
+    if (bitboard_test(&game->boards[PLAYER_INDEX(PLAYER_O)], index)) return PLAYER_O;
+    return EMPTY;
+}
+
+/**
+ * @brief Place le symbole d'un joueur sur une case (sans vérification)
+ * @param game Pointeur vers l'état du jeu
+ * @param index Index de la case
+ * @param player PLAYER_X ou PLAYER_O
+ */
+static inline void set_cell(game_t* game, int index, int player) {
+    bitboard_set(&game->boards[PLAYER_INDEX(player)], index);
+}
+
+/**
+ * @brief Vide une case
+ * @param game Pointeur vers l'état du jeu
+ * @param index Index de la case
+ */
+static inline void clear_cell(game_t* game, int index) {
+    bitboard_reset(&game->boards[PLAYER_INDEX(PLAYER_X)], index);
+    bitboard_reset(&game->boards[PLAYER_INDEX(PLAYER_O)], index);
+}
+
+/**
+ * @brief Renvoie l'ensemble des cases vides
+ * @param game Pointeur vers l'état du jeu
+ */
+static inline bitboard_t empty_cells(const game_t* game) {
+    return bitboard_free(&game->boards[0], &game->boards[1], &game->config->full_mask);
+}
+
+/**
+ * @brief Indique si toutes les cases sont occupées
+ * @param game Pointeur vers l'état du jeu
+ */
+static inline int is_board_full(const game_t* game) {
+    bitboard_t empty = empty_cells(game);
+    return bitboard_is_empty(&empty);
+}
+
+/**
+ * @brief Joue un coup et met à jour les compteurs de lignes
+ *
+ * Seules les lignes passant par la case jouée sont touchées : le coût ne
+ * dépend pas de la taille du plateau. Utilisée par player_turn() et par
+ * la recherche de l'IA, avec unmake_move() pour revenir en arrière.
+ *
+ * @param game Pointeur vers l'état du jeu
+ * @param cell Case vide à occuper
+ * @param player Joueur qui joue (PLAYER_X ou PLAYER_O)
+ * @return CHECK_TRUE si le coup complète une ligne gagnante
+ */
+static inline CheckResult make_move(game_t* game, int cell, int player) {
+    const board_config_t* config = game->config;
+    const int16_t* lines = config->cell_lines[cell];
+    const int line_count = config->cell_line_count[cell];
+    uint8_t* counts = game->line_counts[PLAYER_INDEX(player)];
+    CheckResult won = CHECK_FALSE;
+
+    set_cell(game, cell, player);
+    game->empty_count--;
+
+    for (int i = 0; i < line_count; i++) {
+        if (++counts[lines[i]] == config->win_length) {
+            won = CHECK_TRUE;
+        }
+    }
+    return won;
+}
+
+/**
+ * @brief Annule un coup joué par make_move()
+ * @param game Pointeur vers l'état du jeu
+ * @param cell Case à libérer
+ * @param player Joueur qui l'occupait
+ */
+static inline void unmake_move(game_t* game, int cell, int player) {
+    const board_config_t* config = game->config;
+    const int16_t* lines = config->cell_lines[cell];
+    const int line_count = config->cell_line_count[cell];
+    uint8_t* counts = game->line_counts[PLAYER_INDEX(player)];
+
+    clear_cell(game, cell);
+    game->empty_count++;
+
+    for (int i = 0; i < line_count; i++) {
+        counts[lines[i]]--;
+    }
+}
+
 /*********************************
  * Gestion des tours
  *********************************/
@@ -34,6 +155,17 @@ typedef enum {
  */
 void switch_player(game_t* game);
 
+/**
+ * @brief Passe le tour du joueur actif sans poser de symbole
+ *
+ * Utilisé quand le joueur perd la manche de Snake qui lui aurait donné
+ * la case. Comme un coup joué, le tour passé oublie les coups annulés :
+ * redo_move() ne peut plus rendre la main au joueur qui vient de passer.
+ *
+ * @param game Pointeur vers l'état du jeu
+ */
+void skip_turn(game_t* game);
+
 /**
  * @brief Gère le clic sur une cellule du plateau
  * 
@@ -41,8 +173,8 @@ void switch_player(game_t* game);
  * Elle vérifie la validité du coup et met à jour l'état du jeu en conséquence.
  *
  * @param game Pointeur vers l'état du jeu
- * @param row Ligne ciblée (0-2)
- * @param column Colonne ciblée (0-2)
+ * @param row Ligne ciblée (0 à height - 1)
+ * @param column Colonne ciblée (0 à width - 1)
  */
 void click_on_cell(game_t* game, int row, int column);
 
@@ -53,11 +185,11 @@ void click_on_cell(game_t* game, int row, int column);
 /**
  * @brief Réinitialise complètement l'état du jeu
  * 
- * Remet à zéro :
- * - Le plateau de jeu
+ * Remet à zéro (en conservant la configuration du plateau) :
+ * - Le plateau de jeu et les compteurs de lignes
  * - Le joueur actif
  * - L'état du jeu
- * - Le timer de victoire
+ * - L'historique des coups
  *
  * @param game Pointeur vers l'état du jeu
  */
@@ -67,7 +199,8 @@ void reset_game(game_t* game);
  * @brief Gère un tour de jeu
  * 
  * Place un symbole sur le plateau si possible et vérifie
- * les conditions de fin de partie.
+ * les conditions de fin de partie sur les seules lignes passant
+ * par ce coup.
  *
  * @param game Pointeur vers l'état du jeu
  * @param row Ligne ciblée
@@ -75,6 +208,27 @@ void reset_game(game_t* game);
  */
 void player_turn(game_t* game, int row, int column);
 
+/**
+ * @brief Annule le dernier coup de l'historique
+ *
+ * Retire le symbole avec unmake_move(), rend la main au joueur qui
+ * l'avait posé et remet la partie en cours (une victoire ou un nul
+ * obtenu par ce coup est effacé). Le coup reste disponible pour
+ * redo_move() jusqu'au prochain coup joué. O(1), sans allocation.
+ *
+ * @param game Pointeur vers l'état du jeu
+ * @return 1 si un coup a été annulé, 0 si l'historique est vide
+ */
+int undo_move(game_t* game);
+
+/**
+ * @brief Rejoue le dernier coup annulé par undo_move()
+ *
+ * @param game Pointeur vers l'état du jeu
+ * @return 1 si un coup a été rejoué, 0 s'il n'y en a aucun
+ */
+int redo_move(game_t* game);
+
 /*********************************
  * Vérifications
  *********************************/
@@ -82,10 +236,14 @@ void player_turn(game_t* game, int row, int column);
 /**
  * @brief Vérifie si un joueur a gagné
  *
- * Vérifie toutes les conditions de victoire possibles :
- * - Lignes complètes
- * - Colonnes complètes
- * - Diagonales complètes
+ * Cherche win_length symboles alignés horizontalement, verticalement ou
+ * en diagonale. Les plateaux d'au plus 64 cases comparent le masque du
+ * joueur à la table des lignes gagnantes (un ET et une comparaison par
+ * ligne) ; les plus grands combinent des décalages du masque, dans chaque
+ * direction. Le 3x3, le 4x4 et le 15x15 à 5 alignés ont un chemin dédié.
+ *
+ * Parcourt tout le plateau sans utiliser les compteurs de lignes : à
+ * réserver aux positions construites sans make_move().
  *
  * @param game Pointeur vers l'état du jeu
  * @param player Joueur à vérifier (PLAYER_X ou PLAYER_O)
@@ -101,10 +259,10 @@ CheckResult check_player_won(const game_t* game, int player);
  * - Compter les symboles d'un joueur
  * - Détecter un match nul
  *
- * @param board Plateau de jeu
+ * @param game Pointeur vers l'état du jeu
  * @param cell_type Type de cellule à compter (EMPTY, PLAYER_X, ou PLAYER_O)
  * @return Nombre de cellules du type spécifié
  */
-int count_cells(const int* board, int cell_type);
+int count_cells(const game_t* game, int cell_type);
 
 #endif  /* LOGIC_H_ */
\ No newline at end of file
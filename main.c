@@ -15,6 +15,8 @@
  *********************************/
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 
@@ -23,6 +25,8 @@
 #include "./rendering.h"
 #include "./menu.h"
 #include "./ai.h"
+#include "./ai_worker.h"
+#include "./rng.h"
 #include "./snake.h"
 #include "./window.h"
 
@@ -32,15 +36,28 @@
 #define DEFAULT_FONT_SIZE 24
 #define DEFAULT_FONT_PATH "/usr/share/fonts/truetype/dejavu/DejaVuSans-Bold.ttf"
 
+/** @brief Plateaux proposés par le menu principal (largeur, hauteur, alignement) */
+static const int BOARD_PRESETS[][3] = {
+    {3, 3, 3},    // Morpion classique
+    {4, 4, 4},
+    {15, 15, 5}   // Gomoku
+};
+#define BOARD_PRESET_COUNT ((int)(sizeof(BOARD_PRESETS) / sizeof(BOARD_PRESETS[0])))
+
 /*********************************
  * Prototypes des fonctions statiques
  *********************************/
-static void handle_snake_mode_turn(game_t* game, SDL_Renderer* renderer,
-                                 int row, int col, int is_ai_game, ai_t* ai);
+static void handle_snake_mode_turn(game_t* game, const game_ui_t* ui,
+                                 SDL_Renderer* renderer, int row, int col,
+                                 int is_ai_game, ai_t* ai, ai_worker_t* worker,
+                                 rng_t* rng, const snake_config_t* snake_config);
 static void handle_classic_mode_turn(game_t* game, int row, int col, 
-                                   int is_ai_game, ai_t* ai);
-static void handle_victory_transition(game_t* game);
-static void handle_menu_click_result(menu_t* menu, game_t* game, ai_t* ai,
+                                   int is_ai_game, ai_t* ai, ai_worker_t* worker);
+static void handle_history_key(game_t* game, game_ui_t* ui, int redo, int is_ai_game,
+                               ai_t* ai, ai_worker_t* worker);
+static void handle_victory_transition(game_t* game, game_ui_t* ui);
+static void handle_menu_click_result(menu_t* menu, game_t* game, game_ui_t* ui,
+                                   ai_t* ai, ai_worker_t* worker, rng_t* rng,
                                    int* is_ai_game, int x, int y);
 
 /*********************************
@@ -106,24 +123,120 @@ static SDL_Renderer* create_renderer(SDL_Window* window) {
 }
 
 /**
- * @brief Initialise la structure principale du jeu
- * @param game Structure à initialiser
+ * @brief Lit la configuration du plateau sur la ligne de commande
+ *
+ * Options reconnues :
+ * - --size LARGEURxHAUTEUR : dimensions du plateau
+ * - --win K : nombre de symboles à aligner
+ * - --ai-stats FICHIER : relevé des statistiques de chaque coup de l'IA
+ *   (JSON si le nom finit par .json, CSV sinon ; - pour la sortie d'erreur)
+ * - --seed N : graine des tirages aléatoires (IA, pommes du Snake) ;
+ *   la même graine rejoue les mêmes parties
+ * - --snake-size LARGEURxHAUTEUR : dimensions de la grille du Snake
+ * - --snake-score N : pommes à manger pour valider un coup en mode Snake
+ *
+ * @param argc Nombre d'arguments
+ * @param argv Arguments
+ * @param stats_path Reçoit le fichier du relevé, NULL si aucun
+ * @param seed Reçoit la graine, l'heure courante si elle n'est pas donnée
+ * @param snake_config Reçoit les paramètres du Snake
+ * @return Configuration choisie, NULL si les arguments sont invalides
+ */
+static const board_config_t* parse_arguments(int argc, char* argv[], const char** stats_path,
+                                             uint64_t* seed, snake_config_t* snake_config) {
+    int width = DEFAULT_BOARD_WIDTH;
+    int height = DEFAULT_BOARD_HEIGHT;
+    int win_length = DEFAULT_WIN_LENGTH;
+    int has_win_length = 0;
+
+    *stats_path = NULL;
+    *seed = (uint64_t)time(NULL);
+    snake_config->width = SNAKE_DEFAULT_GRID_SIZE;
+    snake_config->height = SNAKE_DEFAULT_GRID_SIZE;
+    snake_config->target_score = SNAKE_DEFAULT_TARGET_SCORE;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%dx%d", &width, &height) != 2) {
+                return NULL;
+            }
+        } else if (strcmp(argv[i], "--win") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%d", &win_length) != 1) {
+                return NULL;
+            }
+            has_win_length = 1;
+        } else if (strcmp(argv[i], "--ai-stats") == 0 && i + 1 < argc) {
+            *stats_path = argv[++i];
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            unsigned long long value;
+            if (sscanf(argv[++i], "%llu", &value) != 1) {
+                return NULL;
+            }
+            *seed = value;
+        } else if (strcmp(argv[i], "--snake-size") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%dx%d", &snake_config->width, &snake_config->height) != 2) {
+                return NULL;
+            }
+        } else if (strcmp(argv[i], "--snake-score") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%d", &snake_config->target_score) != 1) {
+                return NULL;
+            }
+        } else {
+            return NULL;
+        }
+    }
+
+    if (!snake_config_is_valid(snake_config)) {
+        return NULL;
+    }
+
+    // Par défaut, il faut remplir une ligne du plus petit côté
+    if (!has_win_length) {
+        win_length = (width < height) ? width : height;
+    }
+
+    return get_board_config(width, height, win_length);
+}
+
+/**
+ * @brief Ouvre le relevé des statistiques de l'IA et écrit son en-tête
+ * @param path Fichier, ou - pour la sortie d'erreur
+ * @param format Reçoit le format déduit de l'extension
+ * @return Flux ouvert, NULL en cas d'erreur
  */
-static void initialize_game_state(game_t* game) {
-    // Initialisation du plateau
-    for (int i = 0; i < N * N; i++) {
-        game->board[i] = EMPTY;
+static FILE* open_stats_output(const char* path, AIStatsFormat* format) {
+    const size_t length = strlen(path);
+    *format = (length >= 5 && strcmp(path + length - 5, ".json") == 0)
+            ? AI_STATS_JSON : AI_STATS_CSV;
+
+    FILE* out = (strcmp(path, "-") == 0) ? stderr : fopen(path, "w");
+    if (!out) {
+        fprintf(stderr, "Erreur ouverture %s\n", path);
+        return NULL;
     }
 
+    ai_stats_write_header(out, *format);
+    return out;
+}
+
+/**
+ * @brief Initialise la structure principale du jeu
+ * @param game Structure à initialiser
+ * @param ui Interface de la partie à initialiser
+ * @param config Configuration du plateau
+ */
+static void initialize_game_state(game_t* game, game_ui_t* ui, const board_config_t* config) {
     // Configuration initiale
-    game->player = PLAYER_X;
-    game->state = RUNNING_STATE;
-    game->victory_time = 0;
+    game->config = config;
+    game->is_ai_mode = 0;
     game->is_snake_mode = 0;
-    game->is_fullscreen = 0;
+    ui->is_fullscreen = 0;
+    ui->victory_time = 0;
+
+    // Plateau vide, compteurs de lignes à zéro
+    reset_game(game);
 
     // Initialisation des dimensions
-    update_window_dimensions(game, INITIAL_WIDTH, INITIAL_HEIGHT);
+    update_window_dimensions(ui, config, INITIAL_WIDTH, INITIAL_HEIGHT);
 }
 
 /*********************************
@@ -132,40 +245,54 @@ static void initialize_game_state(game_t* game) {
 /**
  * @brief Gère les événements de clic pendant le jeu
  * @param game État du jeu
+ * @param ui Interface de la partie
  * @param renderer Renderer SDL
  * @param event Événement SDL
  * @param is_ai_game Indique si on joue contre l'IA
  * @param ai Configuration de l'IA
+ * @param worker Thread de recherche de l'IA
+ * @param menu Menu, pour le retour au menu principal
+ * @param rng Tirages de la session (graine du Snake)
+ * @param snake_config Paramètres du Snake
  */
-static void handle_game_click(game_t* game, SDL_Renderer* renderer, 
-                            SDL_Event* event, int is_ai_game, ai_t* ai, menu_t* menu) {
+static void handle_game_click(game_t* game, game_ui_t* ui, SDL_Renderer* renderer,
+                            SDL_Event* event, int is_ai_game, ai_t* ai,
+                            ai_worker_t* worker, menu_t* menu, rng_t* rng,
+                            const snake_config_t* snake_config) {
     // Menu de victoire
     if (game->state == VICTORY_MENU_STATE) {
         SDL_Point click = {event->button.x, event->button.y};
         
-        if (SDL_PointInRect(&click, &game->replay_button)) {
+        if (SDL_PointInRect(&click, &ui->replay_button)) {
+            ai_worker_cancel(worker);
             reset_game(game);
-            game->victory_time = 0;
-        } else if (SDL_PointInRect(&click, &game->menu_button)) {
+            ui->victory_time = 0;
+            if (is_ai_game) {
+                ai_worker_ponder(worker, game, ai);
+            }
+        } else if (SDL_PointInRect(&click, &ui->menu_button)) {
+            ai_worker_cancel(worker);
             reset_game(game);
-            game->victory_time = 0;
+            ui->victory_time = 0;
             menu->mode = MENU_STATE;
             return;
         }
         return;
     }
 
-    // Jeu en cours
-    if (game->state == RUNNING_STATE) {
-        int row = event->button.y / game->dimensions.cell_height;
-        int col = event->button.x / game->dimensions.cell_width;
+    // Jeu en cours, clics ignorés pendant la réflexion de l'IA
+    if (game->state == RUNNING_STATE && !ai_worker_is_thinking(worker)) {
+        int row = event->button.y / ui->dimensions.cell_height;
+        int col = event->button.x / ui->dimensions.cell_width;
         
         // Vérifie si la case est libre
-        if (game->board[row * N + col] == EMPTY) {
+        if (IS_VALID_CELL(game->config, row, col) &&
+            get_cell(game, BOARD_INDEX(game->config, row, col)) == EMPTY) {
             if (game->is_snake_mode) {
-                handle_snake_mode_turn(game, renderer, row, col, is_ai_game, ai);
+                handle_snake_mode_turn(game, ui, renderer, row, col, is_ai_game, ai, worker,
+                                       rng, snake_config);
             } else {
-                handle_classic_mode_turn(game, row, col, is_ai_game, ai);
+                handle_classic_mode_turn(game, row, col, is_ai_game, ai, worker);
             }
         }
     }
@@ -174,58 +301,164 @@ static void handle_game_click(game_t* game, SDL_Renderer* renderer,
 /**
  * @brief Gère un tour en mode Snake
  */
-static void handle_snake_mode_turn(game_t* game, SDL_Renderer* renderer, 
-                                 int row, int col, int is_ai_game, ai_t* ai) {
-    SnakeState result = play_snake_minigame(game, renderer, row, col);
+static void handle_snake_mode_turn(game_t* game, const game_ui_t* ui,
+                                 SDL_Renderer* renderer, int row, int col,
+                                 int is_ai_game, ai_t* ai, ai_worker_t* worker,
+                                 rng_t* rng, const snake_config_t* snake_config) {
+    SnakeState result = play_snake_minigame(snake_config, &ui->dimensions, renderer, row, col,
+                                            rng_next(rng));
     
-    if (result == SNAKE_WON) {
+    if (result == SNAKE_WON || result == SNAKE_FULL) {
         click_on_cell(game, row, col);
-        if (is_ai_game && game->state == RUNNING_STATE && 
-            game->player == PLAYER_O) {
-            ai_make_move(game, ai);
+        if (is_ai_game && game->state != RUNNING_STATE) {
+            ai_worker_cancel(worker);  // Partie terminée : la réflexion de l'IA ne sert plus
+        } else if (is_ai_game && game->player == PLAYER_O) {
+            ai_worker_request(worker, game, ai);
         }
     } else if (result == SNAKE_LOST) {
-        switch_player(game);
+        skip_turn(game);
         if (is_ai_game && game->player == PLAYER_O) {
-            ai_make_move(game, ai);
+            ai_worker_request(worker, game, ai);
         }
     }
 }
 
 /**
  * @brief Gère un tour en mode classique
+ *
+ * Le coup de l'IA est calculé en arrière-plan et joué à la réception
+ * de son résultat (handle_ai_result). Si le coup du joueur termine la
+ * partie, la réflexion lancée pendant son tour est arrêtée.
  */
 static void handle_classic_mode_turn(game_t* game, int row, int col, 
-                                   int is_ai_game, ai_t* ai) {
+                                   int is_ai_game, ai_t* ai, ai_worker_t* worker) {
     click_on_cell(game, row, col);
-    if (is_ai_game && game->state == RUNNING_STATE && 
-        game->player == PLAYER_O) {
-        ai_make_move(game, ai);
+    if (is_ai_game && game->state != RUNNING_STATE) {
+        ai_worker_cancel(worker);
+    } else if (is_ai_game && game->player == PLAYER_O) {
+        ai_worker_request(worker, game, ai);
     }
 }
 
-static void handle_victory_transition(game_t* game) {
+/**
+ * @brief Joue le coup calculé par le thread de l'IA
+ *
+ * Les résultats de demandes annulées, ou arrivant hors partie, sont ignorés.
+ * Le générateur de l'IA reprend l'état atteint par la recherche. Les
+ * statistiques de la recherche sont copiées dans ai->stats et ajoutées
+ * au relevé s'il y en a un. Si la partie continue, l'IA réfléchit pendant
+ * le tour du joueur.
+ */
+static void handle_ai_result(game_t* game, ai_t* ai, ai_worker_t* worker,
+                             const menu_t* menu, const SDL_Event* event,
+                             FILE* stats_out, AIStatsFormat stats_format) {
+    int move;
+    if (!ai_worker_take_result(worker, event, &move, ai)) {
+        return;
+    }
+
+    if (menu->mode == GAME_STATE && game->state == RUNNING_STATE) {
+        if (stats_out) {
+            ai_stats_write(stats_out, stats_format, game, ai);
+        }
+
+        click_on_cell(game, move / game->config->width, move % game->config->width);
+        if (game->state == RUNNING_STATE) {
+            ai_worker_ponder(worker, game, ai);
+        }
+    }
+}
+
+/**
+ * @brief Annule (Ctrl+Z) ou rejoue (Ctrl+Y) des coups de l'historique
+ *
+ * Contre l'IA, recule ou avance jusqu'au prochain tour du joueur : la
+ * réflexion en cours est abandonnée, puis l'IA est relancée si c'est à
+ * elle de jouer un coup qui n'est plus dans l'historique.
+ *
+ * @param game État du jeu
+ * @param ui Interface de la partie (timer de victoire)
+ * @param redo 1 pour rejouer, 0 pour annuler
+ * @param is_ai_game Indique si on joue contre l'IA
+ * @param ai Configuration de l'IA
+ * @param worker Thread de recherche de l'IA
+ */
+static void handle_history_key(game_t* game, game_ui_t* ui, int redo, int is_ai_game,
+                               ai_t* ai, ai_worker_t* worker) {
+    if (redo ? game->redo_count == 0 : game->move_count == 0) {
+        return;
+    }
+
+    int (*step)(game_t*) = redo ? redo_move : undo_move;
+    ai_worker_cancel(worker);
+    step(game);
+    if (is_ai_game) {
+        while (game->state == RUNNING_STATE && game->player == PLAYER_O && step(game)) {
+        }
+    }
+
+    // Une partie terminée peut reprendre : son timer de victoire repart de zéro
+    if (game->state == RUNNING_STATE) {
+        ui->victory_time = 0;
+        if (is_ai_game) {
+            if (game->player == PLAYER_O) {
+                ai_worker_request(worker, game, ai);
+            } else {
+                ai_worker_ponder(worker, game, ai);
+            }
+        }
+    }
+}
+
+static void handle_victory_transition(game_t* game, game_ui_t* ui) {
     if (game->state == PLAYER_X_WON_STATE || 
         game->state == PLAYER_O_WON_STATE || 
         game->state == TIE_STATE) {
         
         // Si nouvelle victoire, enregistre le temps
-        if (game->victory_time == 0) {
-            game->victory_time = SDL_GetTicks();
+        if (ui->victory_time == 0) {
+            ui->victory_time = SDL_GetTicks();
         }
         
         // Après le délai, affiche le menu de victoire
-        if (SDL_GetTicks() - game->victory_time >= VICTORY_DISPLAY_TIME) {
+        if (SDL_GetTicks() - ui->victory_time >= VICTORY_DISPLAY_TIME) {
             game->state = VICTORY_MENU_STATE;
         }
     }
 }
 
-static void handle_menu_click_result(menu_t* menu, game_t* game, ai_t* ai,
+/**
+ * @brief Passe au plateau suivant parmi BOARD_PRESETS
+ *
+ * Depuis une configuration choisie en ligne de commande qui ne fait pas
+ * partie des préréglages, repart du premier.
+ */
+static void select_next_board(game_t* game, game_ui_t* ui, menu_t* menu) {
+    int next = 0;
+    for (int i = 0; i < BOARD_PRESET_COUNT; i++) {
+        if (game->config->width == BOARD_PRESETS[i][0] &&
+            game->config->height == BOARD_PRESETS[i][1] &&
+            game->config->win_length == BOARD_PRESETS[i][2]) {
+            next = (i + 1) % BOARD_PRESET_COUNT;
+        }
+    }
+
+    game->config = get_board_config(BOARD_PRESETS[next][0], BOARD_PRESETS[next][1],
+                                    BOARD_PRESETS[next][2]);
+    reset_game(game);
+    update_window_dimensions(ui, game->config, ui->dimensions.window_width,
+                             ui->dimensions.window_height);
+    set_menu_board_label(menu, game->config);
+}
+
+static void handle_menu_click_result(menu_t* menu, game_t* game, game_ui_t* ui,
+                                   ai_t* ai, ai_worker_t* worker, rng_t* rng,
                                    int* is_ai_game, int x, int y) {
     int result = handle_menu_click(menu, x, y);
     
-    if (result == 0) {  // Mode IA sélectionné
+    if (result == MODE_BOARD_SIZE) {
+        select_next_board(game, ui, menu);
+    } else if (result == 0) {  // Mode IA sélectionné
         *is_ai_game = 1;
         game->is_snake_mode = 0;
     } else if (result == 1) {  // Mode JcJ sélectionné
@@ -238,11 +471,15 @@ static void handle_menu_click_result(menu_t* menu, game_t* game, ai_t* ai,
         *is_ai_game = 0;
         game->is_snake_mode = 1;
         menu->mode = GAME_STATE;
-    } else if (result >= EASY && result <= HARD) {
+    } else if (result == EASY || result == MEDIUM || result == HARD || result == EXPERT) {
         init_ai(ai, result);
+        ai_seed(ai, rng_next(rng));
         *is_ai_game = 1;
         game->is_snake_mode = 0;
         menu->mode = GAME_STATE;
+
+        // Le joueur commence : l'IA réfléchit pendant son premier coup
+        ai_worker_ponder(worker, game, ai);
     }
 }
 
@@ -250,8 +487,30 @@ static void handle_menu_click_result(menu_t* menu, game_t* game, ai_t* ai,
  * @brief Fonction principale
  */
 int main(int argc, char* argv[]) {
-    (void)argc; // Évite l'avertissement de paramètre non utilisé
-    (void)argv;
+    const char* stats_path;
+    uint64_t seed;
+    snake_config_t snake_config;
+    const board_config_t* config = parse_arguments(argc, argv, &stats_path, &seed,
+                                                   &snake_config);
+    if (!config) {
+        fprintf(stderr, "Usage : %s [--size LARGEURxHAUTEUR] [--win K] [--ai-stats FICHIER]"
+                        " [--seed N] [--snake-size LARGEURxHAUTEUR] [--snake-score N]\n"
+                        "  %d <= LARGEUR, HAUTEUR <= %d, %d <= K <= plus grand côté\n"
+                        "  Snake : %d <= LARGEUR, HAUTEUR <= %d, N >= 1\n",
+                argv[0], MIN_BOARD_SIZE, MAX_BOARD_SIZE, MIN_BOARD_SIZE,
+                SNAKE_MIN_GRID_SIZE, SNAKE_MAX_GRID_SIZE);
+        return EXIT_FAILURE;
+    }
+
+    // Relevé optionnel des statistiques de l'IA
+    AIStatsFormat stats_format = AI_STATS_CSV;
+    FILE* stats_out = NULL;
+    if (stats_path) {
+        stats_out = open_stats_output(stats_path, &stats_format);
+        if (!stats_out) {
+            return EXIT_FAILURE;
+        }
+    }
 
     // Initialisation des composants
     if (initialize_sdl() < 0) {
@@ -287,19 +546,37 @@ int main(int argc, char* argv[]) {
 
     // Initialisation des structures de jeu
     game_t game;
-    initialize_game_state(&game);
+    game_ui_t ui;
+    initialize_game_state(&game, &ui, config);
 
     menu_t menu;
     ai_t ai;
+    ai_worker_t worker;
     int is_ai_game = 0;
+    int show_ai_stats = 0;
+
+    // Tirages de la session : graines de l'IA et de chaque Snake
+    rng_t rng;
+    rng_seed(&rng, seed);
     
     init_menu(&menu);
+    set_menu_board_label(&menu, game.config);
+
+    if (ai_worker_start(&worker) < 0) {
+        TTF_CloseFont(font);
+        cleanup_menu(&menu);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroyWindow(window);
+        TTF_Quit();
+        SDL_Quit();
+        return EXIT_FAILURE;
+    }
 
     // Boucle principale
     SDL_Event event;
     while (menu.mode != QUIT_STATE) {
         // Gestion de la transition vers le menu de victoire
-        handle_victory_transition(&game);
+        handle_victory_transition(&game, &ui);
 
         // Gestion des événements
         while (SDL_PollEvent(&event)) {
@@ -308,16 +585,21 @@ int main(int argc, char* argv[]) {
                 break;
             }
 
+            if (event.type == worker.event_type) {
+                handle_ai_result(&game, &ai, &worker, &menu, &event, stats_out, stats_format);
+            }
+
             if (event.type == SDL_MOUSEBUTTONDOWN) {
                 if (menu.mode == MENU_STATE || 
                     menu.mode == AI_DIFFICULTY_STATE || 
                     menu.mode == GAME_MODE_STATE) {
-                    handle_menu_click_result(&menu, &game, &ai, 
+                    handle_menu_click_result(&menu, &game, &ui, &ai, &worker, &rng,
                                           &is_ai_game, event.button.x, 
                                           event.button.y);
                 }
                 else if (menu.mode == GAME_STATE) {
-                    handle_game_click(&game, renderer, &event, is_ai_game, &ai, &menu);
+                    handle_game_click(&game, &ui, renderer, &event, is_ai_game, &ai, &worker,
+                                      &menu, &rng, &snake_config);
                 }
             }
 
@@ -336,14 +618,24 @@ int main(int argc, char* argv[]) {
                             SDL_SetWindowSize(window, width, height);
                         }
                         
-                        update_window_dimensions(&game, width, height);
+                        update_window_dimensions(&ui, game.config, width, height);
                         update_menu_dimensions(&menu, width, height);
                         break;
                 }
             } else if (event.type == SDL_KEYDOWN) {
                 switch (event.key.keysym.sym) {
                     case SDLK_F11:  // F11 pour basculer le mode plein écran
-                        toggle_fullscreen(window, &game);
+                        toggle_fullscreen(window, &ui, game.config);
+                        break;
+                    case SDLK_F3:  // F3 pour afficher les statistiques de l'IA
+                        show_ai_stats = !show_ai_stats;
+                        break;
+                    case SDLK_z:  // Ctrl+Z pour annuler un coup
+                    case SDLK_y:  // Ctrl+Y pour le rejouer
+                        if ((event.key.keysym.mod & KMOD_CTRL) && menu.mode == GAME_STATE) {
+                            handle_history_key(&game, &ui, event.key.keysym.sym == SDLK_y,
+                                               is_ai_game, &ai, &worker);
+                        }
                         break;
                 }
             }
@@ -359,13 +651,20 @@ int main(int argc, char* argv[]) {
             render_menu(renderer, &menu);
         } 
         else if (menu.mode == GAME_STATE) {
-            render_game(renderer, &game, font);
+            render_game(renderer, &game, &ui, font);
+            if (show_ai_stats && is_ai_game) {
+                render_ai_stats(renderer, font, &ai.stats);
+            }
         }
 
         SDL_RenderPresent(renderer);
     }
 
     // Nettoyage
+    ai_worker_stop(&worker);
+    if (stats_out && stats_out != stderr) {
+        fclose(stats_out);
+    }
     TTF_CloseFont(font);
     cleanup_menu(&menu);
     SDL_DestroyRenderer(renderer);
@@ -0,0 +1,565 @@
+/**
+ * @file mcts.c
+ * @brief Implémentation de la recherche Monte-Carlo (UCT)
+ */
+
+#include <math.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "./mcts.h"
+#include "./logic.h"
+
+/*********************************
+ * Configuration
+ *********************************/
+
+/** @brief Nombre de nœuds de chaque arène */
+#define MCTS_ARENA_NODES (1u << 19)
+
+/** @brief Index d'un nœud absent */
+#define MCTS_NULL UINT32_MAX
+
+/** @brief Constante d'exploration de la formule UCT (racine de 2) */
+#define MCTS_EXPLORATION 1.41421356f
+
+/** @brief Nombre de simulations entre deux consultations de l'horloge */
+#define MCTS_CLOCK_CHECK 256
+
+/** @brief Fin de partie atteinte par le coup menant à un nœud */
+typedef enum {
+    MCTS_NOT_TERMINAL = 0,  /**< La partie continue */
+    MCTS_TERMINAL_WIN = 1,  /**< Le coup gagne */
+    MCTS_TERMINAL_DRAW = 2  /**< Le coup remplit le plateau sans aligner */
+} MCTSTerminal;
+
+/**
+ * @brief Nœud de l'arbre
+ *
+ * Un nœud correspond au coup move joué depuis son parent. Ses enfants
+ * forment une liste chaînée (first_child, next_sibling) ; les coups pas
+ * encore développés sont les cases vides de cell_order à partir de
+ * l'indice next_order.
+ */
+typedef struct {
+    uint32_t first_child;   /**< Premier enfant, MCTS_NULL si aucun */
+    uint32_t next_sibling;  /**< Enfant suivant du même parent */
+    uint32_t visits;        /**< Simulations passées par ce nœud */
+    float reward;           /**< Somme des résultats pour le joueur qui a joué move */
+    int16_t move;           /**< Case jouée, -1 pour la racine d'origine */
+    uint16_t next_order;    /**< Prochain indice de cell_order à développer */
+    uint8_t terminal;       /**< MCTSTerminal */
+} mcts_node_t;
+
+/** @brief Zone de nœuds allouée une fois, distribuée par incrément */
+typedef struct {
+    mcts_node_t* nodes;
+    uint32_t used;
+} mcts_arena_t;
+
+/**
+ * @brief Arbre conservé entre deux recherches
+ *
+ * Deux arènes : à chaque recherche, le sous-arbre réutilisé est recopié
+ * dans l'arène inactive, ce qui libère d'un coup tout le reste.
+ *
+ * Chaque thread possède son propre arbre : plusieurs recherches peuvent
+ * tourner en même temps sur des threads différents (tournois).
+ */
+static _Thread_local struct {
+    mcts_arena_t arenas[2];
+    int current;                      /**< Arène contenant l'arbre */
+    uint32_t root;                    /**< Racine, MCTS_NULL si pas d'arbre */
+    const board_config_t* config;     /**< Plateau de l'arbre */
+    bitboard_t boards[2];             /**< Position de la racine */
+    int player;                       /**< Joueur au trait à la racine */
+
+    const board_config_t* order_config;  /**< Plateau pour lequel cell_order est calculé */
+    int16_t cell_order[MAX_CELLS];    /**< Cases triées du centre vers les bords */
+
+    unsigned long generation;         /**< Dernière réinitialisation prise en compte */
+} tree = {
+    .root = MCTS_NULL
+};
+
+/** @brief Nombre d'appels à mcts_reset, comparé à tree.generation */
+static atomic_ulong reset_generation = 1;
+
+/*********************************
+ * Fonctions utilitaires statiques
+ *********************************/
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec * 1e-6;
+}
+
+/**
+ * @brief Applique au thread courant le dernier mcts_reset : l'arbre est oublié
+ */
+static void sync_reset(void) {
+    const unsigned long generation = atomic_load(&reset_generation);
+    if (tree.generation == generation) {
+        return;
+    }
+
+    tree.generation = generation;
+    tree.root = MCTS_NULL;
+    tree.config = NULL;
+}
+
+/**
+ * @brief Alloue les deux arènes à la première utilisation
+ * @return 0 en cas de succès, -1 si la mémoire manque
+ */
+static int ensure_arenas(void) {
+    for (int a = 0; a < 2; a++) {
+        if (!tree.arenas[a].nodes) {
+            tree.arenas[a].nodes = malloc(MCTS_ARENA_NODES * sizeof(mcts_node_t));
+            if (!tree.arenas[a].nodes) {
+                fprintf(stderr, "Erreur allocation arbre MCTS\n");
+                return -1;
+            }
+            tree.arenas[a].used = 0;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Prend un nœud dans l'arène
+ * @return Index du nœud, MCTS_NULL si l'arène est pleine
+ */
+static inline uint32_t alloc_node(mcts_arena_t* arena, int move, int terminal) {
+    if (arena->used == MCTS_ARENA_NODES) {
+        return MCTS_NULL;
+    }
+
+    const uint32_t index = arena->used++;
+    mcts_node_t* node = &arena->nodes[index];
+    node->first_child = MCTS_NULL;
+    node->next_sibling = MCTS_NULL;
+    node->visits = 0;
+    node->reward = 0.0f;
+    node->move = (int16_t)move;
+    node->next_order = 0;
+    node->terminal = (uint8_t)terminal;
+    return index;
+}
+
+/**
+ * @brief Trie les cases du centre vers les bords
+ *
+ * Les coups sont développés dans cet ordre : les cases centrales, en
+ * général les meilleures, sont essayées en premier.
+ */
+static void build_cell_order(const board_config_t* config) {
+    if (tree.order_config == config) {
+        return;
+    }
+
+    int distance[MAX_CELLS];
+    for (int i = 0; i < config->cell_count; i++) {
+        const int dr = 2 * (i / config->width) - (config->height - 1);
+        const int dc = 2 * (i % config->width) - (config->width - 1);
+        distance[i] = dr * dr + dc * dc;
+    }
+
+    // Tri par insertion, stable : à distance égale, l'ordre des index
+    for (int i = 0; i < config->cell_count; i++) {
+        int j = i;
+        while (j > 0 && distance[tree.cell_order[j - 1]] > distance[i]) {
+            tree.cell_order[j] = tree.cell_order[j - 1];
+            j--;
+        }
+        tree.cell_order[j] = (int16_t)i;
+    }
+
+    tree.order_config = config;
+}
+
+/*********************************
+ * Réutilisation de l'arbre
+ *********************************/
+
+/**
+ * @brief Cherche dans l'arbre conservé le nœud de la position courante
+ *
+ * La position doit contenir toutes les pierres de l'ancienne racine ; les
+ * pierres ajoutées depuis sont suivies coup par coup, en alternant les
+ * joueurs, parmi les enfants déjà développés.
+ *
+ * @return Nœud correspondant, MCTS_NULL s'il n'existe pas
+ */
+static uint32_t find_reused_root(const game_t* game) {
+    if (tree.root == MCTS_NULL || tree.config != game->config) {
+        return MCTS_NULL;
+    }
+
+    bitboard_t added[2];
+    int remaining = 0;
+    for (int p = 0; p < 2; p++) {
+        for (int w = 0; w < BITBOARD_WORDS; w++) {
+            if (tree.boards[p].words[w] & ~game->boards[p].words[w]) {
+                return MCTS_NULL;  // Pierre retirée : autre partie
+            }
+            added[p].words[w] = game->boards[p].words[w] & ~tree.boards[p].words[w];
+        }
+        remaining += bitboard_count(&added[p]);
+    }
+
+    const mcts_node_t* nodes = tree.arenas[tree.current].nodes;
+    uint32_t node = tree.root;
+    int player = tree.player;
+
+    for (; remaining > 0; remaining--) {
+        bitboard_t* moves = &added[PLAYER_INDEX(player)];
+        uint32_t child = nodes[node].first_child;
+        while (child != MCTS_NULL && !bitboard_test(moves, nodes[child].move)) {
+            child = nodes[child].next_sibling;
+        }
+        if (child == MCTS_NULL) {
+            return MCTS_NULL;
+        }
+
+        bitboard_reset(moves, nodes[child].move);
+        node = child;
+        player = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    }
+
+    return (player == game->player) ? node : MCTS_NULL;
+}
+
+/**
+ * @brief Recopie un sous-arbre dans une autre arène
+ * @return Index de la copie de la racine du sous-arbre
+ */
+static uint32_t copy_subtree(const mcts_arena_t* src, uint32_t index, mcts_arena_t* dst) {
+    const uint32_t copy = dst->used++;
+    dst->nodes[copy] = src->nodes[index];
+
+    uint32_t* link = &dst->nodes[copy].first_child;
+    for (uint32_t child = src->nodes[index].first_child; child != MCTS_NULL;
+         child = src->nodes[child].next_sibling) {
+        *link = copy_subtree(src, child, dst);
+        link = &dst->nodes[*link].next_sibling;
+    }
+    *link = MCTS_NULL;
+
+    return copy;
+}
+
+/**
+ * @brief Prépare la racine de la recherche, en gardant le sous-arbre utile
+ */
+static void prepare_root(const game_t* game) {
+    const uint32_t reused = find_reused_root(game);
+    const int next = 1 - tree.current;
+
+    tree.arenas[next].used = 0;
+    if (reused != MCTS_NULL) {
+        tree.root = copy_subtree(&tree.arenas[tree.current], reused, &tree.arenas[next]);
+        tree.arenas[next].nodes[tree.root].next_sibling = MCTS_NULL;
+    } else {
+        tree.root = alloc_node(&tree.arenas[next], -1, MCTS_NOT_TERMINAL);
+    }
+
+    tree.current = next;
+    tree.config = game->config;
+    tree.boards[0] = game->boards[0];
+    tree.boards[1] = game->boards[1];
+    tree.player = game->player;
+}
+
+/*********************************
+ * Étapes de la recherche
+ *********************************/
+
+/**
+ * @brief Enfant maximisant la formule UCT
+ *
+ * Tous les enfants ont au moins une visite : chaque nœud développé
+ * reçoit immédiatement une simulation.
+ */
+static uint32_t select_child(const mcts_node_t* nodes, const mcts_node_t* parent) {
+    const float log_visits = logf((float)parent->visits);
+    uint32_t best = MCTS_NULL;
+    float best_value = -1.0f;
+
+    for (uint32_t child = parent->first_child; child != MCTS_NULL;
+         child = nodes[child].next_sibling) {
+        const mcts_node_t* node = &nodes[child];
+        const float value = node->reward / node->visits
+                          + MCTS_EXPLORATION * sqrtf(log_visits / node->visits);
+        if (value > best_value) {
+            best_value = value;
+            best = child;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief Partie aléatoire jusqu'à la fin, sans allocation
+ *
+ * Les cases vides sont tirées dans un tableau sur la pile, retirées par
+ * échange avec la dernière.
+ *
+ * @param game Copie de travail de la position (modifiée)
+ * @param player Joueur au trait
+ * @param rng Générateur des tirages
+ * @return Vainqueur, EMPTY en cas de match nul
+ */
+static int random_playout(game_t* game, int player, rng_t* rng) {
+    int cells[MAX_CELLS];
+    int count = 0;
+
+    bitboard_t empty = empty_cells(game);
+    int i;
+    while ((i = bitboard_pop_lowest(&empty)) >= 0) {
+        cells[count++] = i;
+    }
+
+    while (count > 0) {
+        const int pick = rng_below(rng, count);
+        const int cell = cells[pick];
+        cells[pick] = cells[--count];
+
+        if (make_move(game, cell, player)) {
+            return player;
+        }
+        player = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    }
+
+    return EMPTY;
+}
+
+/**
+ * @brief Remet la copie de travail dans la position de la racine
+ *
+ * Seuls les champs lus et modifiés par make_move() et random_playout()
+ * sont recopiés : les deux bitboards, le nombre de cases vides et les
+ * compteurs des lignes du plateau. line_counts est dimensionné pour
+ * MAX_LINES et une copie complète de game_t coûterait près de 3 Ko par
+ * simulation, quelle que soit la taille du plateau.
+ *
+ * @param work Copie de travail, initialisée par une copie complète de root
+ * @param root Position de la racine
+ */
+static inline void restore_root_position(game_t* work, const game_t* root) {
+    const size_t line_bytes = (size_t)root->config->line_count;
+
+    work->boards[0] = root->boards[0];
+    work->boards[1] = root->boards[1];
+    work->empty_count = root->empty_count;
+    memcpy(work->line_counts[0], root->line_counts[0], line_bytes);
+    memcpy(work->line_counts[1], root->line_counts[1], line_bytes);
+}
+
+/**
+ * @brief Une itération complète : sélection, développement, simulation,
+ * rétropropagation
+ *
+ * Quand l'arène est pleine, l'arbre cesse de grandir : la sélection
+ * s'arrête au premier nœud qui aurait été développé et la simulation
+ * part de sa position, sans créer d'enfant.
+ *
+ * @param root_game Position de la racine
+ * @param game Copie de travail de la racine, remise en place puis modifiée
+ * @param rng Générateur des simulations
+ * @param expanded Reçoit 1 si un nœud a été développé, 0 si l'arène était pleine
+ * @return Profondeur du dernier nœud de la descente
+ */
+static int run_iteration(const game_t* root_game, game_t* game, rng_t* rng, int* expanded) {
+    mcts_arena_t* arena = &tree.arenas[tree.current];
+    mcts_node_t* nodes = arena->nodes;
+    uint32_t path[MAX_CELLS + 1];
+    int length = 0;
+
+    restore_root_position(game, root_game);
+    int player = root_game->player;
+    uint32_t node = tree.root;
+    int winner = EMPTY;
+    path[length++] = node;
+    *expanded = 1;
+
+    for (;;) {
+        // Nœud terminal : le résultat est connu
+        if (nodes[node].terminal != MCTS_NOT_TERMINAL) {
+            const int mover = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+            winner = (nodes[node].terminal == MCTS_TERMINAL_WIN) ? mover : EMPTY;
+            break;
+        }
+
+        // Développement du prochain coup non essayé
+        const board_config_t* config = game->config;
+        int order = nodes[node].next_order;
+        while (order < config->cell_count && get_cell(game, tree.cell_order[order]) != EMPTY) {
+            order++;
+        }
+        nodes[node].next_order = (uint16_t)order;
+
+        if (order < config->cell_count && arena->used == MCTS_ARENA_NODES) {
+            // Arène pleine : simulation depuis ce nœud, sans le développer
+            *expanded = 0;
+            winner = random_playout(game, player, rng);
+            break;
+        }
+
+        if (order < config->cell_count) {
+            const int cell = tree.cell_order[order];
+            const CheckResult won = make_move(game, cell, player);
+            const int terminal = won ? MCTS_TERMINAL_WIN
+                               : (game->empty_count == 0) ? MCTS_TERMINAL_DRAW
+                               : MCTS_NOT_TERMINAL;
+
+            const uint32_t child = alloc_node(arena, cell, terminal);
+            nodes[child].next_sibling = nodes[node].first_child;
+            nodes[node].first_child = child;
+            nodes[node].next_order = (uint16_t)(order + 1);
+            path[length++] = child;
+
+            const int next = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+            winner = won ? player
+                   : (terminal == MCTS_TERMINAL_DRAW) ? EMPTY
+                   : random_playout(game, next, rng);
+            break;
+        }
+
+        // Tous les coups sont développés : descente selon UCT
+        node = select_child(nodes, &nodes[node]);
+        make_move(game, nodes[node].move, player);
+        player = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+        path[length++] = node;
+    }
+
+    // Rétropropagation : chaque nœud est noté pour le joueur qui y a mené
+    int mover = (root_game->player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    for (int i = 0; i < length; i++) {
+        mcts_node_t* visited = &nodes[path[i]];
+        visited->visits++;
+        visited->reward += (winner == mover) ? 1.0f : (winner == EMPTY) ? 0.5f : 0.0f;
+        mover = (mover == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    }
+
+    return length - 1;
+}
+
+/**
+ * @brief Prépare l'arbre pour une recherche depuis une position
+ * @return 0 en cas de succès, -1 si aucune case n'est libre ou si la mémoire manque
+ */
+static int start_search(const game_t* game) {
+    sync_reset();
+    if (game->empty_count == 0 || ensure_arenas() < 0) {
+        return -1;
+    }
+
+    build_cell_order(game->config);
+    prepare_root(game);
+    return 0;
+}
+
+/**
+ * @brief Enchaîne les itérations depuis la racine jusqu'à épuisement du budget
+ *
+ * S'arrête à l'échéance, au budget de simulations, à la demande
+ * d'interruption (ai->search_aborted vaut alors 1) ou, si until_full vaut
+ * 1, quand l'arène est pleine. ai->stats reçoit le nombre de simulations
+ * et la profondeur atteinte.
+ *
+ * @param game Position de la racine
+ * @param ai Configuration de l'IA (générateur, demande d'interruption)
+ * @param deadline Échéance (ms), 0 pour aucune
+ * @param playout_budget Simulations maximales, 0 pour aucune limite
+ * @param until_full 1 pour s'arrêter quand l'arbre ne peut plus grandir
+ */
+static void run_simulations(const game_t* game, ai_t* ai, double deadline,
+                            unsigned long playout_budget, int until_full) {
+    unsigned long playouts = 0;
+    rng_t rng = ai->rng;  // Copie locale, rendue à l'IA à la fin
+    game_t work = *game;  // Copie complète une fois par recherche
+
+    for (;;) {
+        if (playout_budget && playouts >= playout_budget) {
+            break;
+        }
+        if (until_full && tree.arenas[tree.current].used == MCTS_ARENA_NODES) {
+            break;
+        }
+        if (playouts % MCTS_CLOCK_CHECK == 0 && playouts > 0) {
+            if (deadline > 0 && now_ms() >= deadline) {
+                break;
+            }
+            if (ai->stop_flag && atomic_load_explicit(ai->stop_flag, memory_order_relaxed)) {
+                ai->search_aborted = 1;
+                break;
+            }
+        }
+        int expanded;
+        const int depth = run_iteration(game, &work, &rng, &expanded);
+        if (!expanded) {
+            ai->stats.tree_full_playouts++;
+        }
+        if (depth > ai->stats.max_depth) {
+            ai->stats.max_depth = depth;
+        }
+        playouts++;
+    }
+
+    ai->stats.nodes = playouts;
+    ai->rng = rng;
+}
+
+/*********************************
+ * Implémentation des fonctions publiques
+ *********************************/
+
+void mcts_reset(void) {
+    atomic_fetch_add(&reset_generation, 1);
+}
+
+void mcts_free(void) {
+    for (int a = 0; a < 2; a++) {
+        free(tree.arenas[a].nodes);
+        tree.arenas[a].nodes = NULL;
+    }
+    tree.root = MCTS_NULL;
+    tree.config = NULL;
+}
+
+int mcts_get_move(const game_t* game, ai_t* ai) {
+    if (start_search(game) < 0) {
+        return -1;
+    }
+    ai->stats.reused_playouts = tree.arenas[tree.current].nodes[tree.root].visits;
+    run_simulations(game, ai, now_ms() + ai->time_budget_ms, ai->playout_budget, 0);
+
+    // Coup le plus exploré
+    const mcts_node_t* nodes = tree.arenas[tree.current].nodes;
+    int best_move = -1;
+    uint32_t best_visits = 0;
+    for (uint32_t child = nodes[tree.root].first_child; child != MCTS_NULL;
+         child = nodes[child].next_sibling) {
+        if (best_move < 0 || nodes[child].visits > best_visits) {
+            best_visits = nodes[child].visits;
+            best_move = nodes[child].move;
+        }
+    }
+
+    return best_move;
+}
+
+void mcts_ponder(const game_t* game, ai_t* ai) {
+    if (start_search(game) < 0) {
+        return;
+    }
+
+    // Sans demande d'interruption possible, le temps d'un coup au plus
+    const double deadline = ai->stop_flag ? 0 : now_ms() + ai->time_budget_ms;
+    run_simulations(game, ai, deadline, 0, 1);
+}
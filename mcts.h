@@ -0,0 +1,69 @@
+/**
+ * @file mcts.h
+ * @brief Recherche arborescente Monte-Carlo (UCT) du niveau expert
+ *
+ * Au lieu d'explorer l'arbre à profondeur fixe, la recherche répète dans
+ * le temps imparti (ou pour un nombre donné de simulations) :
+ * 1. Sélection : descente depuis la racine en suivant la formule UCT
+ * 2. Développement : ajout d'un coup non encore essayé
+ * 3. Simulation : partie aléatoire jusqu'à la fin, sans allocation
+ * 4. Rétropropagation : mise à jour des statistiques du chemin
+ *
+ * Les nœuds sont pris dans une zone mémoire allouée une seule fois.
+ * L'arbre est conservé d'un tour à l'autre : si la nouvelle position
+ * descend de l'ancienne racine, le sous-arbre correspondant est gardé.
+ *
+ * L'arbre est propre à chaque thread ; les simulations tirent leurs coups
+ * dans le générateur de l'IA (ai->rng).
+ */
+
+#ifndef MCTS_H_
+#define MCTS_H_
+
+#include <stdint.h>
+#include "./game.h"
+#include "./ai.h"
+
+/**
+ * @brief Oublie les arbres conservés
+ *
+ * S'applique à tous les threads, à leur prochaine recherche.
+ */
+void mcts_reset(void);
+
+/**
+ * @brief Libère l'arbre du thread appelant
+ *
+ * À appeler avant la fin d'un thread qui a utilisé mcts_get_move ; une
+ * recherche ultérieure réalloue l'arbre.
+ */
+void mcts_free(void);
+
+/**
+ * @brief Choisit un coup par recherche Monte-Carlo
+ *
+ * Le budget est fixé par ai->time_budget_ms et ai->playout_budget ;
+ * ai->stats reçoit le nombre de simulations effectuées et la profondeur
+ * maximale atteinte dans l'arbre.
+ *
+ * @param game Position à analyser (non modifiée)
+ * @param ai Configuration de l'IA
+ * @return Case du coup le plus exploré, -1 si aucune case n'est libre
+ */
+int mcts_get_move(const game_t* game, ai_t* ai);
+
+/**
+ * @brief Fait grandir l'arbre pendant le tour adverse
+ *
+ * Lance des simulations depuis la position où l'adversaire est au trait,
+ * sans choisir de coup. Quand il joue, mcts_get_move() repart du
+ * sous-arbre de son coup, déjà exploré. S'arrête à la demande
+ * d'interruption (ai->stop_flag), quand l'arbre ne peut plus grandir ou,
+ * sans stop_flag, après ai->time_budget_ms.
+ *
+ * @param game Position, l'adversaire au trait (non modifiée)
+ * @param ai Configuration de l'IA
+ */
+void mcts_ponder(const game_t* game, ai_t* ai);
+
+#endif  /* MCTS_H_ */
@@ -3,6 +3,7 @@
  * @brief Implémentation de la gestion des menus avec nouveau thème noir/rouge/bleu
  */
 
+#include <stdio.h>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL2_gfxPrimitives.h>
@@ -218,6 +219,14 @@ void render_menu(SDL_Renderer* renderer, const menu_t* menu) {
             draw_button_text(renderer, menu->font, "Joueur vs IA",
                            &menu->ai_button, &THEME.text,
                            SDL_PointInRect(&mouse, &menu->ai_button));
+
+            // Choix du plateau
+            draw_styled_button(renderer, &menu->board_button,
+                             &THEME.button, &THEME.text_secondary,
+                             SDL_PointInRect(&mouse, &menu->board_button));
+            draw_button_text(renderer, menu->font, menu->board_label,
+                           &menu->board_button, &THEME.text,
+                           SDL_PointInRect(&mouse, &menu->board_button));
             break;
 
         case AI_DIFFICULTY_STATE:
@@ -236,6 +245,9 @@ void render_menu(SDL_Renderer* renderer, const menu_t* menu) {
             draw_styled_button(renderer, &menu->hard_button,
                              &THEME.button, &THEME.accent2,
                              SDL_PointInRect(&mouse, &menu->hard_button));
+            draw_styled_button(renderer, &menu->expert_button,
+                             &THEME.button, &THEME.accent2,
+                             SDL_PointInRect(&mouse, &menu->expert_button));
 
             draw_button_text(renderer, menu->font, "Facile",
                            &menu->easy_button, &THEME.text,
@@ -246,6 +258,9 @@ void render_menu(SDL_Renderer* renderer, const menu_t* menu) {
             draw_button_text(renderer, menu->font, "Difficile",
                            &menu->hard_button, &THEME.text,
                            SDL_PointInRect(&mouse, &menu->hard_button));
+            draw_button_text(renderer, menu->font, "Expert",
+                           &menu->expert_button, &THEME.text,
+                           SDL_PointInRect(&mouse, &menu->expert_button));
             break;
 
         case GAME_MODE_STATE:
@@ -276,6 +291,7 @@ void render_menu(SDL_Renderer* renderer, const menu_t* menu) {
 }
 void init_menu(menu_t* menu) {
     menu->mode = MENU_STATE;
+    menu->board_label[0] = '\0';
     
     // Chargement de la police
     menu->font = TTF_OpenFont(DEFAULT_FONT_PATH, FONT_SIZE);
@@ -288,6 +304,11 @@ void init_menu(menu_t* menu) {
     update_menu_dimensions(menu, INITIAL_WIDTH, INITIAL_HEIGHT);
 }
 
+void set_menu_board_label(menu_t* menu, const board_config_t* config) {
+    snprintf(menu->board_label, sizeof(menu->board_label), "%dx%d, k=%d",
+             config->width, config->height, config->win_length);
+}
+
 /**
  * @brief Remet le menu dans son état initial
  *
@@ -324,6 +345,9 @@ int handle_menu_click(menu_t* menu, int x, int y) {
                 menu->mode = AI_DIFFICULTY_STATE;
                 return 0;  // Signal pour mode IA
             }
+            if (SDL_PointInRect(&click, &menu->board_button)) {
+                return MODE_BOARD_SIZE;  // Reste sur le menu principal
+            }
             break;
 
         case AI_DIFFICULTY_STATE:
@@ -339,6 +363,10 @@ int handle_menu_click(menu_t* menu, int x, int y) {
                 menu->mode = GAME_STATE;
                 return HARD;
             }
+            if (SDL_PointInRect(&click, &menu->expert_button)) {
+                menu->mode = GAME_STATE;
+                return EXPERT;
+            }
             break;
 
         case GAME_MODE_STATE:
@@ -383,11 +411,13 @@ void update_menu_dimensions(menu_t* menu, int width, int height) {
     // Menu principal
     menu->player_button = (SDL_Rect){x_offset, y_base, button_width, button_height};
     menu->ai_button = (SDL_Rect){x_offset, y_base + button_height + spacing, button_width, button_height};
+    menu->board_button = (SDL_Rect){x_offset, y_base + 2 * (button_height + spacing), button_width, button_height};
 
     // Menu difficulté
     menu->easy_button = (SDL_Rect){x_offset, y_base, button_width, button_height};
     menu->medium_button = (SDL_Rect){x_offset, y_base + button_height + spacing, button_width, button_height};
     menu->hard_button = (SDL_Rect){x_offset, y_base + 2 * (button_height + spacing), button_width, button_height};
+    menu->expert_button = (SDL_Rect){x_offset, y_base + 3 * (button_height + spacing), button_width, button_height};
 
     // Menu mode de jeu
     menu->classic_button = (SDL_Rect){x_offset, y_base, button_width, button_height};
@@ -36,8 +36,9 @@
 
 /** @brief Modes de jeu spéciaux */
 typedef enum {
-    MODE_CLASSIC = 20,  /**< Mode de jeu classique */
-    MODE_SNAKE = 21     /**< Mode avec mini-jeu Snake */
+    MODE_CLASSIC = 20,    /**< Mode de jeu classique */
+    MODE_SNAKE = 21,      /**< Mode avec mini-jeu Snake */
+    MODE_BOARD_SIZE = 40  /**< Passage à la taille de plateau suivante */
 } GameMode;
 
 /** @brief États possibles du menu */
@@ -68,8 +69,11 @@ typedef struct {
     SDL_Rect easy_button;     /**< Bouton difficulté facile */
     SDL_Rect medium_button;   /**< Bouton difficulté moyenne */
     SDL_Rect hard_button;     /**< Bouton difficulté difficile */
+    SDL_Rect expert_button;   /**< Bouton difficulté expert (Monte-Carlo) */
     SDL_Rect classic_button;  /**< Bouton mode classique */
     SDL_Rect snake_button;    /**< Bouton mode snake */
+    SDL_Rect board_button;    /**< Bouton de choix du plateau */
+    char board_label[32];     /**< Texte du bouton de choix du plateau */
     TTF_Font* font;          /**< Police pour le texte */
     window_dimensions_t dimensions; /**< Nouvelle dimensions*/
 } menu_t;
@@ -127,6 +131,14 @@ void render_menu(SDL_Renderer* renderer, const menu_t* menu);
  */
 int handle_menu_click(menu_t* menu, int x, int y);
 
+/**
+ * @brief Met à jour le texte du bouton de choix du plateau
+ *
+ * @param menu Menu à mettre à jour
+ * @param config Configuration de plateau affichée
+ */
+void set_menu_board_label(menu_t* menu, const board_config_t* config);
+
 /**
  * @brief Réinitialise le menu à son état initial
  * @param menu Menu à réinitialiser
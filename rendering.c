@@ -4,6 +4,7 @@
  */
 
 #include <math.h>
+#include <stdio.h>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL2_gfxPrimitives.h>
 #include <SDL2/SDL_ttf.h>
@@ -24,6 +25,17 @@
 #define SYMBOL_THICKNESS 10
 #define SYMBOL_SIZE_RATIO 0.25f
 
+/** @brief Épaisseur maximale des symboles relativement à leur demi-taille */
+#define SYMBOL_THICKNESS_RATIO 0.5f
+
+/** @brief Épaisseur du trait barrant la ligne gagnante */
+#define WINNING_LINE_THICKNESS 6
+
+/** @brief Réduction du texte et marge de l'encadré des statistiques de l'IA */
+#define STATS_TEXT_SCALE 0.6f
+#define STATS_MARGIN 8
+#define STATS_LINE_COUNT 4
+
 typedef struct {
     SDL_Color background;
     SDL_Color button;
@@ -202,10 +214,11 @@ static void draw_button_text(SDL_Renderer* renderer, TTF_Font* font,
  * @brief Dessine la grille de jeu
  * 
  * @param renderer Contexte de rendu SDL
- * @param game État du jeu contenant les dimensions
+ * @param game État du jeu
+ * @param ui Dimensions de la fenêtre et des cases
  * @param color Couleur de la grille (NULL pour couleur par défaut)
  */
-static void render_grid(SDL_Renderer* renderer, const game_t* game, const SDL_Color* color) {
+static void render_grid(SDL_Renderer* renderer, const game_t* game, const game_ui_t* ui, const SDL_Color* color) {
     // Utilise la couleur passée en paramètre ou la couleur par défaut de la grille
     const SDL_Color* grid_color = color ? color : &THEME.grid;
     
@@ -216,17 +229,17 @@ static void render_grid(SDL_Renderer* renderer, const game_t* game, const SDL_Co
         grid_color->a);
 
     // Lignes verticales
-    for (int i = 1; i < N; ++i) {
+    for (int i = 1; i < game->config->width; ++i) {
         SDL_RenderDrawLine(renderer,
-            i * game->dimensions.cell_width, 0,
-            i * game->dimensions.cell_width, game->dimensions.window_height);
+            i * ui->dimensions.cell_width, 0,
+            i * ui->dimensions.cell_width, ui->dimensions.window_height);
     }
 
     // Lignes horizontales
-    for (int i = 1; i < N; ++i) {
+    for (int i = 1; i < game->config->height; ++i) {
         SDL_RenderDrawLine(renderer,
-            0, i * game->dimensions.cell_height,
-            game->dimensions.window_width, i * game->dimensions.cell_height);
+            0, i * ui->dimensions.cell_height,
+            ui->dimensions.window_width, i * ui->dimensions.cell_height);
     }
 }
 
@@ -234,22 +247,24 @@ static void render_grid(SDL_Renderer* renderer, const game_t* game, const SDL_Co
  * @brief Dessine un symbole X dans une cellule
  * 
  * @param renderer Contexte de rendu SDL
- * @param game État du jeu contenant les dimensions
+ * @param ui Dimensions de la fenêtre et des cases
  * @param row Ligne de la cellule
  * @param column Colonne de la cellule
  * @param color Couleur du symbole
  */
-static void render_x(SDL_Renderer* renderer, const game_t* game, int row, int column, const SDL_Color* color) {
-    const float half_box_side = fmin(game->dimensions.cell_width, game->dimensions.cell_height) * SYMBOL_SIZE_RATIO;
-    const float center_x = game->dimensions.cell_width * 0.5 + column * game->dimensions.cell_width;
-    const float center_y = game->dimensions.cell_height * 0.5 + row * game->dimensions.cell_height;
+static void render_x(SDL_Renderer* renderer, const game_ui_t* ui, int row, int column, const SDL_Color* color) {
+    const float half_box_side = fmin(ui->dimensions.cell_width, ui->dimensions.cell_height) * SYMBOL_SIZE_RATIO;
+    const float center_x = ui->dimensions.cell_width * 0.5 + column * ui->dimensions.cell_width;
+    const float center_y = ui->dimensions.cell_height * 0.5 + row * ui->dimensions.cell_height;
+    // Traits plus fins sur les grands plateaux, où les cases sont petites
+    const int thickness = (int)fmin(SYMBOL_THICKNESS, half_box_side * SYMBOL_THICKNESS_RATIO);
 
     thickLineRGBA(renderer,
         center_x - half_box_side,
         center_y - half_box_side,
         center_x + half_box_side,
         center_y + half_box_side,
-        SYMBOL_THICKNESS,
+        thickness,
         color->r, color->g, color->b, color->a);
 
     thickLineRGBA(renderer,
@@ -257,7 +272,7 @@ static void render_x(SDL_Renderer* renderer, const game_t* game, int row, int co
         center_y - half_box_side,
         center_x - half_box_side,
         center_y + half_box_side,
-        SYMBOL_THICKNESS,
+        thickness,
         color->r, color->g, color->b, color->a);
 }
 
@@ -265,24 +280,25 @@ static void render_x(SDL_Renderer* renderer, const game_t* game, int row, int co
  * @brief Dessine un symbole O dans une cellule
  * 
  * @param renderer Contexte de rendu SDL
- * @param game État du jeu contenant les dimensions
+ * @param ui Dimensions de la fenêtre et des cases
  * @param row Ligne de la cellule
  * @param column Colonne de la cellule
  * @param color Couleur du symbole
  */
-static void render_o(SDL_Renderer* renderer, const game_t* game, int row, int column, const SDL_Color* color) {
-    const float half_box_side = fmin(game->dimensions.cell_width, game->dimensions.cell_height) * SYMBOL_SIZE_RATIO;
-    const float center_x = game->dimensions.cell_width * 0.5 + column * game->dimensions.cell_width;
-    const float center_y = game->dimensions.cell_height * 0.5 + row * game->dimensions.cell_height;
+static void render_o(SDL_Renderer* renderer, const game_ui_t* ui, int row, int column, const SDL_Color* color) {
+    const float half_box_side = fmin(ui->dimensions.cell_width, ui->dimensions.cell_height) * SYMBOL_SIZE_RATIO;
+    const float center_x = ui->dimensions.cell_width * 0.5 + column * ui->dimensions.cell_width;
+    const float center_y = ui->dimensions.cell_height * 0.5 + row * ui->dimensions.cell_height;
+    const float ring = fmin(SYMBOL_THICKNESS, half_box_side * SYMBOL_THICKNESS_RATIO) / 2;
 
     filledCircleRGBA(renderer,
         center_x, center_y,
-        half_box_side + 5,
+        half_box_side + ring,
         color->r, color->g, color->b, color->a);
 
     filledCircleRGBA(renderer,
         center_x, center_y,
-        half_box_side - 5,
+        half_box_side - ring,
         THEME.background.r, THEME.background.g, THEME.background.b, THEME.background.a);
 }
 
@@ -291,20 +307,21 @@ static void render_o(SDL_Renderer* renderer, const game_t* game, int row, int co
  * 
  * @param renderer Contexte de rendu SDL
  * @param game État du jeu à afficher
+ * @param ui Dimensions de la fenêtre et des cases
  * @param override_color Couleur de surcharge (NULL pour couleurs par défaut)
  */
-static void render_board(SDL_Renderer* renderer, const game_t* game, const SDL_Color* override_color) {
+static void render_board(SDL_Renderer* renderer, const game_t* game, const game_ui_t* ui, const SDL_Color* override_color) {
     const SDL_Color* x_color = override_color ? override_color : &THEME.accent1;
     const SDL_Color* o_color = override_color ? override_color : &THEME.accent2;
 
-    for (int i = 0; i < N; ++i) {
-        for (int j = 0; j < N; ++j) {
-            switch (game->board[i * N + j]) {
+    for (int i = 0; i < game->config->height; ++i) {
+        for (int j = 0; j < game->config->width; ++j) {
+            switch (get_cell(game, BOARD_INDEX(game->config, i, j))) {
                 case PLAYER_X:
-                    render_x(renderer, game, i, j, x_color);
+                    render_x(renderer, ui, i, j, x_color);
                     break;
                 case PLAYER_O:
-                    render_o(renderer, game, i, j, o_color);
+                    render_o(renderer, ui, i, j, o_color);
                     break;
                 default:
                     break;
@@ -313,20 +330,64 @@ static void render_board(SDL_Renderer* renderer, const game_t* game, const SDL_C
     }
 }
 
+/**
+ * @brief Barre la ligne gagnante mise en cache à la fin de la partie
+ *
+ * @param renderer Contexte de rendu SDL
+ * @param game État du jeu (sans effet s'il n'y a pas de vainqueur)
+ * @param ui Dimensions de la fenêtre et des cases
+ */
+static void render_winning_line(SDL_Renderer* renderer, const game_t* game, const game_ui_t* ui) {
+    if (game->winner == EMPTY || game->winning_cell_count == 0) {
+        return;
+    }
+
+    const int width = game->config->width;
+    const int first = game->winning_cells[0];
+    const int last = game->winning_cells[game->winning_cell_count - 1];
+    const float cell_width = ui->dimensions.cell_width;
+    const float cell_height = ui->dimensions.cell_height;
+    const int thickness = (int)fmin(WINNING_LINE_THICKNESS,
+                                    fmin(cell_width, cell_height) * SYMBOL_SIZE_RATIO);
+
+    thickLineRGBA(renderer,
+        (first % width + 0.5f) * cell_width,
+        (first / width + 0.5f) * cell_height,
+        (last % width + 0.5f) * cell_width,
+        (last / width + 0.5f) * cell_height,
+        thickness,
+        THEME.text.r, THEME.text.g, THEME.text.b, THEME.text.a);
+}
+
+/**
+ * @brief Couleur associée au résultat mis en cache de la partie
+ */
+static const SDL_Color* result_color(const game_t* game) {
+    switch (game->winner) {
+        case PLAYER_X:
+            return &THEME.accent1;
+        case PLAYER_O:
+            return &THEME.accent2;
+        default:
+            return &THEME.text_secondary;
+    }
+}
+
 /**
  * @brief Affiche le plateau de jeu en cours de partie
  * 
  * @param renderer Contexte de rendu SDL
  * @param game État du jeu à afficher
+ * @param ui Dimensions de la fenêtre et des cases
  */
-static void render_running_state(SDL_Renderer* renderer, const game_t* game) {
+static void render_running_state(SDL_Renderer* renderer, const game_t* game, const game_ui_t* ui) {
     SDL_SetRenderDrawColor(renderer, 
         THEME.background.r, THEME.background.g, 
         THEME.background.b, THEME.background.a);
     SDL_RenderClear(renderer);
 
-    render_grid(renderer, game, NULL);
-    render_board(renderer, game, NULL);
+    render_grid(renderer, game, ui, NULL);
+    render_board(renderer, game, ui, NULL);
 }
 
 /**
@@ -334,46 +395,40 @@ static void render_running_state(SDL_Renderer* renderer, const game_t* game) {
  * 
  * @param renderer Contexte de rendu SDL
  * @param game État du jeu à afficher
+ * @param ui Dimensions de la fenêtre et des cases
  * @param color Couleur à utiliser pour l'affichage
  */
-static void render_game_over_state(SDL_Renderer* renderer, const game_t* game, const SDL_Color* color) {
+static void render_game_over_state(SDL_Renderer* renderer, const game_t* game, const game_ui_t* ui, const SDL_Color* color) {
     SDL_SetRenderDrawColor(renderer, 
         THEME.background.r, THEME.background.g, 
         THEME.background.b, THEME.background.a);
     SDL_RenderClear(renderer);
 
-    render_grid(renderer, game, color);
-    render_board(renderer, game, color);
+    render_grid(renderer, game, ui, color);
+    render_board(renderer, game, ui, color);
+    render_winning_line(renderer, game, ui);
 }
 
-void render_victory_menu(SDL_Renderer* renderer, const game_t* game, TTF_Font* font) {
+void render_victory_menu(SDL_Renderer* renderer, const game_t* game, const game_ui_t* ui, TTF_Font* font) {
     // Activation du mode de fusion pour les effets de transparence
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
     
     // Fond avec dégradé subtil
-    for (int y = 0; y < game->dimensions.window_height; y++) {
-        float factor = (float)y / game->dimensions.window_height;
+    for (int y = 0; y < ui->dimensions.window_height; y++) {
+        float factor = (float)y / ui->dimensions.window_height;
         SDL_SetRenderDrawColor(renderer,
             THEME.overlay.r + (int)(10 * factor),
             THEME.overlay.g + (int)(10 * factor),
             THEME.overlay.b + (int)(10 * factor),
             THEME.overlay.a);
-        SDL_RenderDrawLine(renderer, 0, y, game->dimensions.window_width, y);
+        SDL_RenderDrawLine(renderer, 0, y, ui->dimensions.window_width, y);
     }
 
-    // Détermination des couleurs selon le résultat
-    const SDL_Color* accent_color;
-    const char* message;
-    if (check_player_won(game, PLAYER_X)) {
-        accent_color = &THEME.accent1;
-        message = "VICTOIRE JOUEUR X";
-    } else if (check_player_won(game, PLAYER_O)) {
-        accent_color = &THEME.accent2;
-        message = "VICTOIRE JOUEUR O";
-    } else {
-        accent_color = &THEME.text_secondary;
-        message = "MATCH NUL";
-    }
+    // Détermination des couleurs selon le résultat mis en cache
+    const SDL_Color* accent_color = result_color(game);
+    const char* message = (game->winner == PLAYER_X) ? "VICTOIRE JOUEUR X"
+                        : (game->winner == PLAYER_O) ? "VICTOIRE JOUEUR O"
+                        : "MATCH NUL";
 
     // Position de la souris pour les effets de survol
     int mouse_x, mouse_y;
@@ -381,14 +436,14 @@ void render_victory_menu(SDL_Renderer* renderer, const game_t* game, TTF_Font* f
     SDL_Point mouse = {mouse_x, mouse_y};
 
     // Texte de victoire avec effet de lueur
-    int title_y = game->dimensions.window_height / 4;
+    int title_y = ui->dimensions.window_height / 4;
     
     // Effet de lueur derrière le texte
     for (int i = VICTORY_GLOW_INTENSITY; i > 0; i--) {
         roundedBoxRGBA(renderer,
-            game->dimensions.window_width/4 - i*4,
+            ui->dimensions.window_width/4 - i*4,
             title_y - 30 - i*4,
-            3*game->dimensions.window_width/4 + i*4,
+            3*ui->dimensions.window_width/4 + i*4,
             title_y + 30 + i*4,
             BUTTON_CORNER_RADIUS + i,
             accent_color->r, accent_color->g, accent_color->b, 20/i);
@@ -396,53 +451,90 @@ void render_victory_menu(SDL_Renderer* renderer, const game_t* game, TTF_Font* f
 
     // Texte de victoire
     draw_victory_text(renderer, font, message, title_y,
-                     game->dimensions.window_width, accent_color);
+                     ui->dimensions.window_width, accent_color);
 
     // Boutons
-    SDL_bool replay_hovered = SDL_PointInRect(&mouse, &game->replay_button);
-    SDL_bool menu_hovered = SDL_PointInRect(&mouse, &game->menu_button);
+    SDL_bool replay_hovered = SDL_PointInRect(&mouse, &ui->replay_button);
+    SDL_bool menu_hovered = SDL_PointInRect(&mouse, &ui->menu_button);
 
     // Bouton Rejouer
-    draw_styled_button(renderer, &game->replay_button,
+    draw_styled_button(renderer, &ui->replay_button,
                       &THEME.button, accent_color, replay_hovered);
     draw_button_text(renderer, font, "Rejouer",
-                    &game->replay_button, &THEME.text, replay_hovered);
+                    &ui->replay_button, &THEME.text, replay_hovered);
 
     // Bouton Menu
-    draw_styled_button(renderer, &game->menu_button,
+    draw_styled_button(renderer, &ui->menu_button,
                       &THEME.button, accent_color, menu_hovered);
     draw_button_text(renderer, font, "Menu Principal",
-                    &game->menu_button, &THEME.text, menu_hovered);
+                    &ui->menu_button, &THEME.text, menu_hovered);
 }
 
-void render_game(SDL_Renderer* renderer, const game_t* game, TTF_Font* font) {
+void render_game(SDL_Renderer* renderer, const game_t* game, const game_ui_t* ui, TTF_Font* font) {
     switch (game->state) {
         case RUNNING_STATE:
-            render_running_state(renderer, game);
+            render_running_state(renderer, game, ui);
             break;
         case PLAYER_X_WON_STATE:
-            render_game_over_state(renderer, game, &THEME.accent1);
+            render_game_over_state(renderer, game, ui, &THEME.accent1);
             break;
         case PLAYER_O_WON_STATE:
-            render_game_over_state(renderer, game, &THEME.accent2);
+            render_game_over_state(renderer, game, ui, &THEME.accent2);
             break;
         case TIE_STATE:
-            render_game_over_state(renderer, game, &THEME.text_secondary);
+            render_game_over_state(renderer, game, ui, &THEME.text_secondary);
             break;
         case VICTORY_MENU_STATE:
-            // On détermine la couleur à utiliser selon le gagnant
-            const SDL_Color* victory_color = NULL;
-            if (check_player_won(game, PLAYER_X)) {
-                victory_color = &THEME.accent1;
-            } else if (check_player_won(game, PLAYER_O)) {
-                victory_color = &THEME.accent2;
-            } else {
-                victory_color = &THEME.text_secondary;
-            }
-            render_game_over_state(renderer, game, victory_color);
-            render_victory_menu(renderer, game, font);
+            // Couleur du gagnant, lue dans le résultat mis en cache
+            render_game_over_state(renderer, game, ui, result_color(game));
+            render_victory_menu(renderer, game, ui, font);
             break;
         default:
             break;
     }
-}
\ No newline at end of file
+}
+
+void render_ai_stats(SDL_Renderer* renderer, TTF_Font* font, const ai_stats_t* stats) {
+    char lines[STATS_LINE_COUNT][64];
+    snprintf(lines[0], sizeof(lines[0]), "IA : %.1f ms%s", stats->wall_time_ms,
+             stats->ponder_hit ? " (coup préparé)" : "");
+    snprintf(lines[1], sizeof(lines[1]), "Nœuds : %lu (%.2f M/s)", stats->nodes,
+             stats->nodes_per_second * 1e-6);
+    snprintf(lines[2], sizeof(lines[2]), "Table : %lu  Coupures : %lu", stats->tt_hits,
+             stats->cutoffs);
+    snprintf(lines[3], sizeof(lines[3]), "Profondeur : %d (max %d)", stats->depth,
+             stats->max_depth);
+
+    const int line_height = (int)(TTF_FontLineSkip(font) * STATS_TEXT_SCALE);
+    int width = 0;
+    for (int i = 0; i < STATS_LINE_COUNT; i++) {
+        int w;
+        if (TTF_SizeUTF8(font, lines[i], &w, NULL) == 0 && w > width) {
+            width = w;
+        }
+    }
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    roundedBoxRGBA(renderer, STATS_MARGIN / 2, STATS_MARGIN / 2,
+                   (int)(width * STATS_TEXT_SCALE) + 3 * STATS_MARGIN / 2,
+                   STATS_LINE_COUNT * line_height + 3 * STATS_MARGIN / 2,
+                   BUTTON_CORNER_RADIUS,
+                   THEME.overlay.r, THEME.overlay.g, THEME.overlay.b, THEME.overlay.a);
+
+    for (int i = 0; i < STATS_LINE_COUNT; i++) {
+        SDL_Surface* surface = TTF_RenderUTF8_Blended(font, lines[i], THEME.text_secondary);
+        if (!surface) {
+            continue;
+        }
+        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+        SDL_Rect rect = {
+            STATS_MARGIN,
+            STATS_MARGIN + i * line_height,
+            (int)(surface->w * STATS_TEXT_SCALE),
+            (int)(surface->h * STATS_TEXT_SCALE)
+        };
+        SDL_RenderCopy(renderer, texture, NULL, &rect);
+        SDL_DestroyTexture(texture);
+        SDL_FreeSurface(surface);
+    }
+}
@@ -15,6 +15,8 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include "./game.h"
+#include "./ai.h"
+#include "./window.h"
 
 /*********************************
  * Configuration du rendu
@@ -55,9 +57,11 @@ typedef struct {
  *
  * @param renderer Contexte de rendu SDL
  * @param game État du jeu à afficher
+ * @param ui Dimensions de la fenêtre et boutons
  * @param font Police pour le texte
  */
-void render_game(SDL_Renderer* renderer, const game_t* game, TTF_Font* font);
+void render_game(SDL_Renderer* renderer, const game_t* game, const game_ui_t* ui,
+                 TTF_Font* font);
 
 /**
  * @brief Affiche le menu de victoire
@@ -69,8 +73,23 @@ void render_game(SDL_Renderer* renderer, const game_t* game, TTF_Font* font);
  * 
  * @param renderer Contexte de rendu SDL
  * @param game État du jeu
+ * @param ui Dimensions de la fenêtre et boutons
  * @param font Police pour le texte
  */
-void render_victory_menu(SDL_Renderer* renderer, const game_t* game, TTF_Font* font);
+void render_victory_menu(SDL_Renderer* renderer, const game_t* game, const game_ui_t* ui,
+                         TTF_Font* font);
+
+/**
+ * @brief Affiche les statistiques du dernier coup de l'IA
+ *
+ * Petit encadré semi-transparent en haut à gauche de la fenêtre : durée,
+ * nœuds et débit, accès à la table de transposition, coupures et
+ * profondeurs atteintes.
+ *
+ * @param renderer Renderer SDL
+ * @param font Police (réduite à l'affichage)
+ * @param stats Statistiques à afficher
+ */
+void render_ai_stats(SDL_Renderer* renderer, TTF_Font* font, const ai_stats_t* stats);
 
 #endif  /* RENDERING_H_ */
\ No newline at end of file
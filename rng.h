@@ -0,0 +1,74 @@
+/**
+ * @file rng.h
+ * @brief Générateur pseudo-aléatoire xoshiro256** à état explicite
+ *
+ * Chaque utilisateur (IA, Snake, thread d'un tournoi) possède son propre
+ * rng_t : aucun état global, aucun verrou, et une même graine redonne
+ * exactement la même suite de tirages, donc les mêmes parties.
+ *
+ * Les fonctions sont déclarées static inline : elles sont appelées à
+ * chaque coup des simulations Monte-Carlo.
+ */
+
+#ifndef RNG_H_
+#define RNG_H_
+
+#include <stdint.h>
+
+/** @brief État du générateur */
+typedef struct {
+    uint64_t s[4];
+} rng_t;
+
+/**
+ * @brief Étape de splitmix64, pour étaler une graine sur les 256 bits d'état
+ */
+static inline uint64_t rng_splitmix64(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Initialise le générateur à partir d'une graine quelconque
+ *
+ * Des graines voisines (0, 1, 2...) donnent des suites indépendantes.
+ */
+static inline void rng_seed(rng_t* rng, uint64_t seed) {
+    for (int i = 0; i < 4; i++) {
+        rng->s[i] = rng_splitmix64(&seed);
+    }
+}
+
+static inline uint64_t rng_rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+/**
+ * @brief Tire 64 bits
+ */
+static inline uint64_t rng_next(rng_t* rng) {
+    uint64_t* s = rng->s;
+    const uint64_t result = rng_rotl(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rng_rotl(s[3], 45);
+
+    return result;
+}
+
+/**
+ * @brief Entier dans [0, bound[ (multiplication plutôt que modulo)
+ * @param bound Borne, au moins 1
+ */
+static inline int rng_below(rng_t* rng, int bound) {
+    return (int)(((rng_next(rng) >> 32) * (uint64_t)bound) >> 32);
+}
+
+#endif  /* RNG_H_ */
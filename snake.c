@@ -4,7 +4,6 @@
  */
 
 #include <stdlib.h>
-#include <time.h>
 #include "snake.h"
 
 /*********************************
@@ -24,171 +23,102 @@ static const SDL_Color BG_COLOR = {0, 0, 0, 255};      // Noir
  *********************************/
 
 /**
- * @brief Vérifie si la pomme est sur le serpent
- *
- * @param snake État du jeu
- * @param x Position X à vérifier
- * @param y Position Y à vérifier
- * @return 1 si collision, 0 sinon
+ * @brief Partie de la grille affichée à l'écran
  */
-static int is_apple_on_snake(const snake_t* snake, int x, int y) {
-    SnakeSegment* current = snake->head;
-    while (current) {
-        if (current->x == x && current->y == y) {
-            return 1;
-        }
-        current = current->next;
-    }
-    return 0;
-}
+typedef struct {
+    int x;              /**< Première colonne visible */
+    int y;              /**< Première ligne visible */
+    int columns;        /**< Nombre de colonnes visibles */
+    int rows;           /**< Nombre de lignes visibles */
+    float cell_width;   /**< Largeur d'une case (pixels) */
+    float cell_height;  /**< Hauteur d'une case (pixels) */
+} snake_view_t;
 
 /**
- * @brief Place une nouvelle pomme aléatoirement
+ * @brief Cases visibles sur un axe
  *
- * @param snake État du jeu
- */
-static void spawn_new_apple(snake_t* snake) {
-    do {
-        snake->apple_x = rand() % SNAKE_GRID_SIZE;
-        snake->apple_y = rand() % SNAKE_GRID_SIZE;
-    } while (is_apple_on_snake(snake, snake->apple_x, snake->apple_y));
-}
-
-/**
- * @brief Vérifie les collisions avec les murs
+ * Toute la grille si ses cases font au moins SNAKE_MIN_CELL_PIXELS,
+ * sinon autant de cases de cette taille que la fenêtre en contient,
+ * centrées sur la tête et sans dépasser du bord.
  *
- * @param snake État du jeu
- * @return 1 si collision, 0 sinon
+ * @param window_size Taille de la fenêtre sur l'axe (pixels)
+ * @param grid_size Taille de la grille sur l'axe (cases)
+ * @param head Position de la tête sur l'axe
+ * @param first Reçoit la première case visible
+ * @param count Reçoit le nombre de cases visibles
+ * @return Taille d'une case (pixels)
  */
-static int check_wall_collision(const snake_t* snake) {
-    return (snake->head->x < 0 || snake->head->x >= SNAKE_GRID_SIZE ||
-            snake->head->y < 0 || snake->head->y >= SNAKE_GRID_SIZE);
+static float view_axis(int window_size, int grid_size, int head, int* first, int* count) {
+    const float cell_size = (float)window_size / grid_size;
+    if (cell_size >= SNAKE_MIN_CELL_PIXELS) {
+        *first = 0;
+        *count = grid_size;
+        return cell_size;
+    }
+
+    *count = (window_size + SNAKE_MIN_CELL_PIXELS - 1) / SNAKE_MIN_CELL_PIXELS;
+    *first = head - *count / 2;
+    if (*first > grid_size - *count) *first = grid_size - *count;
+    if (*first < 0) *first = 0;
+    return SNAKE_MIN_CELL_PIXELS;
 }
 
 /**
- * @brief Vérifie les collisions avec le corps du serpent
- *
- * @param snake État du jeu
- * @return 1 si collision, 0 sinon
+ * @brief Calcule la partie de la grille affichée
  */
-static int check_self_collision(const snake_t* snake) {
-    SnakeSegment* current = snake->head->next;  // Commence au second segment
-    while (current) {
-        if (current->x == snake->head->x && current->y == snake->head->y) {
-            return 1;
-        }
-        current = current->next;
-    }
-    return 0;
+static snake_view_t compute_view(const snake_t* snake) {
+    const snake_game_t* game = &snake->game;
+    const SnakeSegment* head = &game->body[game->head];
+    snake_view_t view;
+    view.cell_width = view_axis(snake->dimensions.window_width, game->config.width,
+                                head->x, &view.x, &view.columns);
+    view.cell_height = view_axis(snake->dimensions.window_height, game->config.height,
+                                 head->y, &view.y, &view.rows);
+    return view;
 }
 
 /**
- * @brief Ajoute un segment au serpent
- *
- * @param snake État du jeu
- * @param x Position X du nouveau segment
- * @param y Position Y du nouveau segment
+ * @brief Dessine une case de la grille si elle est visible
  */
-static void add_segment(snake_t* snake, int x, int y) {
-    SnakeSegment* new_segment = malloc(sizeof(SnakeSegment));
-    if (!new_segment) return;  // Gestion d'erreur d'allocation
-
-    new_segment->x = x;
-    new_segment->y = y;
-    new_segment->next = NULL;
-
-    // Attache le segment
-    if (snake->tail) {
-        snake->tail->next = new_segment;
-    } else {
-        snake->head = new_segment;
+static void fill_cell(SDL_Renderer* renderer, const snake_view_t* view, int x, int y) {
+    if (x < view->x || x >= view->x + view->columns ||
+        y < view->y || y >= view->y + view->rows) {
+        return;
     }
-    snake->tail = new_segment;
+
+    SDL_Rect cell = {
+        (int)((x - view->x) * view->cell_width),
+        (int)((y - view->y) * view->cell_height),
+        (int)view->cell_width - 1,
+        (int)view->cell_height - 1
+    };
+    SDL_RenderFillRect(renderer, &cell);
 }
 
 /*********************************
  * Implémentation des fonctions publiques
  *********************************/
 
-void init_snake_game(snake_t* snake, int target_row, int target_col, const window_dimensions_t* dimensions) {
-    // Position initiale au centre
-    int start_x = SNAKE_GRID_SIZE / 2;
-    int start_y = SNAKE_GRID_SIZE / 2;
-
-    // Initialisation du serpent
-    snake->head = NULL;
-    snake->tail = NULL;
-    add_segment(snake, start_x, start_y);
+int init_snake_game(snake_t* snake, const snake_config_t* config, int target_row,
+                    int target_col, const window_dimensions_t* dimensions, uint64_t seed) {
+    if (snake_game_init(&snake->game, config, seed) < 0) {
+        return -1;
+    }
 
-    // Configuration initiale
-    snake->direction = SNAKE_RIGHT;
-    snake->score = 0;
-    snake->state = SNAKE_RUNNING;
+    // Transition et case ciblée
     snake->zoom_factor = 0.0f;
     snake->target_cell.x = target_col;
     snake->target_cell.y = target_row;
-
-    // Initialise le générateur aléatoire
-    srand((unsigned int)time(NULL));
-    spawn_new_apple(snake);
     snake->dimensions = *dimensions;  // Copie les dimensions actuelles
-}
-
-void update_snake(snake_t* snake) {
-    if (snake->state != SNAKE_RUNNING) return;
-
-    // Sauvegarde l'ancienne position de la tête
-    int prev_x = snake->head->x;
-    int prev_y = snake->head->y;
-
-    // Déplace la tête selon la direction
-    switch (snake->direction) {
-        case SNAKE_UP:    snake->head->y--; break;
-        case SNAKE_DOWN:  snake->head->y++; break;
-        case SNAKE_LEFT:  snake->head->x--; break;
-        case SNAKE_RIGHT: snake->head->x++; break;
-    }
-
-    // Vérifie les collisions
-    if (check_wall_collision(snake) || check_self_collision(snake)) {
-        snake->state = SNAKE_LOST;
-        return;
-    }
-
-    // Vérifie si une pomme est mangée
-    if (snake->head->x == snake->apple_x && snake->head->y == snake->apple_y) {
-        snake->score++;
-        
-        // Vérifie la victoire
-        if (snake->score >= SNAKE_MIN_SCORE) {
-            snake->state = SNAKE_WON;
-            return;
-        }
-
-        // Ajoute un segment et place une nouvelle pomme
-        add_segment(snake, prev_x, prev_y);
-        spawn_new_apple(snake);
-    }
-
-    // Déplace le corps
-    SnakeSegment* current = snake->head->next;
-    while (current) {
-        int temp_x = current->x;
-        int temp_y = current->y;
-        current->x = prev_x;
-        current->y = prev_y;
-        prev_x = temp_x;
-        prev_y = temp_y;
-        current = current->next;
-    }
+    return 0;
 }
 
 void render_snake_game(SDL_Renderer* renderer, const snake_t* snake) {
+    const snake_game_t* game = &snake->game;
     const int window_width = snake->dimensions.window_width;
     const int window_height = snake->dimensions.window_height;
 
-    float cell_width = (float)window_width / SNAKE_GRID_SIZE;
-    float cell_height = (float)window_height / SNAKE_GRID_SIZE;
+    const snake_view_t view = compute_view(snake);
     
     float zoom_offset_x = (window_width * snake->zoom_factor) / 2;
     float zoom_offset_y = (window_height * snake->zoom_factor) / 2;
@@ -208,33 +138,30 @@ void render_snake_game(SDL_Renderer* renderer, const snake_t* snake) {
     };
     SDL_RenderSetViewport(renderer, &viewport);
 
-    // Dessine le serpent
+    // Dessine le serpent : ses segments s'il est plus court que la vue,
+    // sinon les cases visibles occupées
     SDL_SetRenderDrawColor(renderer, 
         SNAKE_COLOR.r, SNAKE_COLOR.g, SNAKE_COLOR.b, SNAKE_COLOR.a);
     
-    SnakeSegment* current = snake->head;
-    while (current) {
-        SDL_Rect segment = {
-            (int)(current->x * cell_width),
-            (int)(current->y * cell_height),
-            (int)cell_width - 1,
-            (int)cell_height - 1
-        };
-        SDL_RenderFillRect(renderer, &segment);
-        current = current->next;
+    if (game->length <= view.columns * view.rows) {
+        for (int i = 0; i < game->length; i++) {
+            const SnakeSegment* current = snake_segment(game, i);
+            fill_cell(renderer, &view, current->x, current->y);
+        }
+    } else {
+        for (int y = view.y; y < view.y + view.rows; y++) {
+            for (int x = view.x; x < view.x + view.columns; x++) {
+                if (snake_is_occupied(game, x, y)) {
+                    fill_cell(renderer, &view, x, y);
+                }
+            }
+        }
     }
 
     // Dessine la pomme
     SDL_SetRenderDrawColor(renderer, 
         APPLE_COLOR.r, APPLE_COLOR.g, APPLE_COLOR.b, APPLE_COLOR.a);
-    
-    SDL_Rect apple = {
-        (int)(snake->apple_x * cell_width),
-        (int)(snake->apple_y * cell_height),
-        (int)cell_width - 1,
-        (int)cell_height - 1
-    };
-    SDL_RenderFillRect(renderer, &apple);
+    fill_cell(renderer, &view, game->apple_x, game->apple_y);
 
     // Réinitialise le viewport et l'échelle
         SDL_RenderSetViewport(renderer, NULL);
@@ -242,7 +169,7 @@ void render_snake_game(SDL_Renderer* renderer, const snake_t* snake) {
 }
 
 void animate_snake_transition(snake_t* snake, float dt) {
-    if (snake->state == SNAKE_WON) {
+    if (snake->game.state == SNAKE_WON || snake->game.state == SNAKE_FULL) {
         snake->zoom_factor += (ZOOM_SPEED * dt);
         if (snake->zoom_factor > 1.0f) {
             snake->zoom_factor = 1.0f;
@@ -260,31 +187,22 @@ int handle_snake_input(SDL_Event* event, snake_t* snake) {
         return 1;
     }
 
-    SnakeDirection current = snake->direction;
-    
+    // Les demi-tours sont ignorés par snake_turn()
     switch (event->key.keysym.sym) {
         case SDLK_UP:
-            if (current != SNAKE_DOWN) {
-                snake->direction = SNAKE_UP;
-            }
+            snake_turn(&snake->game, SNAKE_UP);
             break;
             
         case SDLK_DOWN:
-            if (current != SNAKE_UP) {
-                snake->direction = SNAKE_DOWN;
-            }
+            snake_turn(&snake->game, SNAKE_DOWN);
             break;
             
         case SDLK_LEFT:
-            if (current != SNAKE_RIGHT) {
-                snake->direction = SNAKE_LEFT;
-            }
+            snake_turn(&snake->game, SNAKE_LEFT);
             break;
             
         case SDLK_RIGHT:
-            if (current != SNAKE_LEFT) {
-                snake->direction = SNAKE_RIGHT;
-            }
+            snake_turn(&snake->game, SNAKE_RIGHT);
             break;
             
         case SDLK_ESCAPE:
@@ -298,21 +216,17 @@ int handle_snake_input(SDL_Event* event, snake_t* snake) {
 }
 
 void cleanup_snake(snake_t* snake) {
-    SnakeSegment* current = snake->head;
-    while (current) {
-        SnakeSegment* next = current->next;
-        free(current);
-        current = next;
-    }
-    snake->head = NULL;
-    snake->tail = NULL;
+    snake_game_free(&snake->game);
 }
 
-SnakeState play_snake_minigame(game_t* game, SDL_Renderer* renderer, 
-                              int row, int col) {
+SnakeState play_snake_minigame(const snake_config_t* config,
+                              const window_dimensions_t* dimensions, SDL_Renderer* renderer,
+                              int row, int col, uint64_t seed) {
     // Initialisation du mini-jeu
     snake_t snake;
-    init_snake_game(&snake, row, col, &game->dimensions);
+    if (init_snake_game(&snake, config, row, col, dimensions, seed) < 0) {
+        return SNAKE_NONE;
+    }
 
     // Variables pour la gestion du temps
     Uint32 lastTime = SDL_GetTicks();
@@ -332,18 +246,16 @@ SnakeState play_snake_minigame(game_t* game, SDL_Renderer* renderer,
         // Gestion des événements
         while (SDL_PollEvent(&event)) {
             if (event.type == SDL_QUIT || !handle_snake_input(&event, &snake)) {
-                snake.state = SNAKE_LOST;
+                snake.game.state = SNAKE_LOST;
                 running = 0;
                 break;
             }
         }
 
-        // Mise à jour du jeu à intervalle fixe
+        // Un tick à intervalle fixe, dans la direction choisie au clavier
         if (accumulator >= SNAKE_SPEED) {
-            update_snake(&snake);
             accumulator = 0;
-            
-            if (snake.state != SNAKE_RUNNING) {
+            if (snake_step(&snake.game, snake.game.direction) != SNAKE_RUNNING) {
                 running = 0;
             }
         }
@@ -368,7 +280,7 @@ SnakeState play_snake_minigame(game_t* game, SDL_Renderer* renderer,
     }
 
     // Sauvegarde le résultat et nettoie
-    SnakeState final_state = snake.state;
+    SnakeState final_state = snake.game.state;
     cleanup_snake(&snake);
     return final_state;
 }
\ No newline at end of file
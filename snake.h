@@ -5,76 +5,42 @@
  * Ce module implémente un mini-jeu Snake qui sert de condition
  * pour placer un symbole dans le Tic-Tac-Toe. Le joueur doit
  * atteindre un score minimum dans le Snake pour pouvoir jouer son coup.
+ * Les règles sont dans snake_logic.h ; ce module les affiche et les
+ * fait avancer au rythme de l'horloge et du clavier.
  */
 
 #ifndef SNAKE_H_
 #define SNAKE_H_
 
+#include <stdint.h>
 #include <SDL2/SDL.h>
 #include "./game.h"
+#include "./snake_logic.h"
 #include "./window.h"
 
 /*********************************
- * Configuration du Snake
- *********************************/
-
-/** @brief Dimensions de la grille du Snake */
-#define SNAKE_GRID_SIZE 20
-
-/** @brief Score nécessaire pour gagner */
-#define SNAKE_MIN_SCORE 5
-
-/** @brief Délai entre deux mouvements (ms) */
-#define SNAKE_SPEED 100
-
-/*********************************
- * Énumérations
+ * Configuration de l'affichage
  *********************************/
 
 /**
- * @brief États possibles du mini-jeu Snake
+ * @brief Taille minimale d'une case à l'écran (pixels)
+ * Une grille plus grande que la fenêtre n'est affichée qu'en partie,
+ * autour de la tête.
  */
-typedef enum {
-    SNAKE_NONE,     /**< État initial/invalide */
-    SNAKE_RUNNING,  /**< Partie en cours */
-    SNAKE_WON,      /**< Victoire (score atteint) */
-    SNAKE_LOST      /**< Défaite (collision) */
-} SnakeState;
+#define SNAKE_MIN_CELL_PIXELS 8
 
-/**
- * @brief Directions possibles du serpent
- */
-typedef enum {
-    SNAKE_UP,     /**< Déplacement vers le haut */
-    SNAKE_DOWN,   /**< Déplacement vers le bas */
-    SNAKE_LEFT,   /**< Déplacement vers la gauche */
-    SNAKE_RIGHT   /**< Déplacement vers la droite */
-} SnakeDirection;
+/** @brief Délai entre deux mouvements (ms) */
+#define SNAKE_SPEED 100
 
 /*********************************
  * Structures
  *********************************/
 
 /**
- * @brief Segment du corps du serpent
- */
-typedef struct SnakeSegment {
-    int x;                     /**< Position X sur la grille */
-    int y;                     /**< Position Y sur la grille */
-    struct SnakeSegment* next; /**< Segment suivant */
-} SnakeSegment;
-
-/**
- * @brief État complet du jeu Snake
+ * @brief Partie de Snake affichée dans la fenêtre
  */
 typedef struct {
-    SnakeSegment* head;      /**< Tête du serpent */
-    SnakeSegment* tail;      /**< Queue du serpent */
-    SnakeDirection direction; /**< Direction actuelle */
-    int apple_x;             /**< Position X de la pomme */
-    int apple_y;             /**< Position Y de la pomme */
-    int score;              /**< Score actuel */
-    SnakeState state;       /**< État du jeu */
+    snake_game_t game;      /**< Règles : serpent, pomme, score */
     float zoom_factor;      /**< Facteur de zoom pour transition */
     SDL_Point target_cell;  /**< Case du morpion ciblée */
     window_dimensions_t dimensions; /**< Nouvelles dimensions*/
@@ -88,30 +54,23 @@ typedef struct {
 /**
  * @brief Initialise une nouvelle partie de Snake
  *
- * @param snake Structure à initialiser
+ * @param snake Structure à initialiser (libérée par cleanup_snake())
+ * @param config Dimensions de la grille et score à atteindre (valides)
  * @param target_row Ligne ciblée dans le morpion
  * @param target_col Colonne ciblée dans le morpion
  * @param dimensions Dimensions actuelles de la fenêtre
+ * @param seed Graine du générateur des pommes
+ * @return 0 en cas de succès, -1 si la mémoire manque
  */
-void init_snake_game(snake_t* snake, int target_row, int target_col, 
-                    const window_dimensions_t* dimensions);
-
-/**
- * @brief Met à jour l'état du jeu
- *
- * Gère :
- * - Le déplacement du serpent
- * - La collecte des pommes
- * - Les collisions
- * - Le score
- *
- * @param snake État du jeu à mettre à jour
- */
-void update_snake(snake_t* snake);
+int init_snake_game(snake_t* snake, const snake_config_t* config, int target_row,
+                    int target_col, const window_dimensions_t* dimensions, uint64_t seed);
 
 /**
  * @brief Gère l'affichage du jeu
  *
+ * Seules les cases visibles sont dessinées : le coût d'une image dépend
+ * de la taille de la fenêtre, pas de celle de la grille.
+ *
  * @param renderer Contexte de rendu SDL
  * @param snake État du jeu à afficher
  */
@@ -127,7 +86,7 @@ void render_snake_game(SDL_Renderer* renderer, const snake_t* snake);
 int handle_snake_input(SDL_Event* event, snake_t* snake);
 
 /**
- * @brief Nettoie les ressources du jeu
+ * @brief Libère les tableaux de la partie
  *
  * @param snake Structure à nettoyer
  */
@@ -149,13 +108,17 @@ void animate_snake_transition(snake_t* snake, float dt);
  * 2. Gère la boucle de jeu
  * 3. Retourne le résultat
  *
- * @param game État du morpion
+ * @param config Dimensions de la grille et score à atteindre
+ * @param dimensions Dimensions actuelles de la fenêtre
  * @param renderer Contexte de rendu SDL
  * @param row Ligne ciblée
  * @param col Colonne ciblée
- * @return État final du Snake (gagné/perdu)
+ * @param seed Graine du générateur des pommes
+ * @return État final du Snake (gagné/perdu), SNAKE_NONE si la partie n'a
+ *         pas pu commencer faute de mémoire
  */
-SnakeState play_snake_minigame(game_t* game, SDL_Renderer* renderer, 
-                              int row, int col);
+SnakeState play_snake_minigame(const snake_config_t* config,
+                              const window_dimensions_t* dimensions, SDL_Renderer* renderer,
+                              int row, int col, uint64_t seed);
 
 #endif  /* SNAKE_H_ */
\ No newline at end of file
@@ -0,0 +1,233 @@
+/**
+ * @file snake_logic.c
+ * @brief Implémentation des règles du Snake
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "./snake_logic.h"
+
+/*********************************
+ * Fonctions utilitaires statiques
+ *********************************/
+
+/**
+ * @brief Indice d'une case dans la grille d'occupation
+ */
+static inline int cell_index(const snake_game_t* game, int x, int y) {
+    return y * game->config.width + x;
+}
+
+/**
+ * @brief Marque une case comme occupée par le serpent
+ *
+ * La case quitte l'ensemble des cases libres : la dernière de la liste
+ * prend sa place.
+ */
+static inline void occupy_cell(snake_game_t* game, int x, int y) {
+    const int cell = cell_index(game, x, y);
+    game->occupied[cell / 64] |= (uint64_t)1 << (cell % 64);
+
+    const int position = game->free_position[cell];
+    const int last = game->free_cells[--game->free_count];
+    game->free_cells[position] = last;
+    game->free_position[last] = position;
+}
+
+/**
+ * @brief Marque une case comme libre, en fin de liste des cases libres
+ */
+static inline void release_cell(snake_game_t* game, int x, int y) {
+    const int cell = cell_index(game, x, y);
+    game->occupied[cell / 64] &= ~((uint64_t)1 << (cell % 64));
+
+    game->free_cells[game->free_count] = cell;
+    game->free_position[cell] = game->free_count++;
+}
+
+/**
+ * @brief Vide la grille : aucune case occupée, toutes libres
+ */
+static void clear_grid(snake_game_t* game) {
+    memset(game->occupied, 0, (size_t)(game->cell_count + 63) / 64 * sizeof(uint64_t));
+    for (int cell = 0; cell < game->cell_count; cell++) {
+        game->free_cells[cell] = cell;
+        game->free_position[cell] = cell;
+    }
+    game->free_count = game->cell_count;
+}
+
+/**
+ * @brief Place une nouvelle pomme sur une case libre tirée au hasard
+ *
+ * @param game État de la partie
+ * @return 1 si la pomme est placée, 0 si la grille est pleine
+ */
+static int spawn_new_apple(snake_game_t* game) {
+    if (game->free_count == 0) {
+        return 0;
+    }
+
+    const int cell = game->free_cells[rng_below(&game->rng, game->free_count)];
+    game->apple_x = cell % game->config.width;
+    game->apple_y = cell / game->config.width;
+    return 1;
+}
+
+/**
+ * @brief Vérifie si une case est hors de la grille
+ *
+ * @param game État de la partie
+ * @param x Position X
+ * @param y Position Y
+ * @return 1 si collision avec un mur, 0 sinon
+ */
+static int is_wall(const snake_game_t* game, int x, int y) {
+    return (x < 0 || x >= game->config.width || y < 0 || y >= game->config.height);
+}
+
+/**
+ * @brief Avance la tête d'une case, sans rien déplacer d'autre
+ *
+ * @param game État de la partie
+ * @param x Position X de la nouvelle tête
+ * @param y Position Y de la nouvelle tête
+ * @param grow 1 pour garder la queue (pomme mangée), 0 pour l'oublier
+ */
+static void push_head(snake_game_t* game, int x, int y, int grow) {
+    // La queue libère sa case avant que la tête n'écrase, peut-être, son indice
+    if (grow) {
+        game->length++;
+    } else {
+        const SnakeSegment* tail = snake_segment(game, 0);
+        release_cell(game, tail->x, tail->y);
+    }
+
+    if (++game->head == game->cell_count) {
+        game->head = 0;
+    }
+    game->body[game->head].x = (int16_t)x;
+    game->body[game->head].y = (int16_t)y;
+    occupy_cell(game, x, y);
+}
+
+/*********************************
+ * Implémentation des fonctions publiques
+ *********************************/
+
+int snake_config_is_valid(const snake_config_t* config) {
+    return config->width >= SNAKE_MIN_GRID_SIZE && config->width <= SNAKE_MAX_GRID_SIZE &&
+           config->height >= SNAKE_MIN_GRID_SIZE && config->height <= SNAKE_MAX_GRID_SIZE &&
+           config->target_score >= 1;
+}
+
+int snake_game_init(snake_game_t* game, const snake_config_t* config, uint64_t seed) {
+    // Tableaux à la taille de la grille, alloués une fois pour la partie
+    game->config = *config;
+    game->cell_count = config->width * config->height;
+    game->body = malloc((size_t)game->cell_count * sizeof(SnakeSegment));
+    game->occupied = malloc((size_t)(game->cell_count + 63) / 64 * sizeof(uint64_t));
+    game->free_cells = malloc((size_t)game->cell_count * sizeof(int));
+    game->free_position = malloc((size_t)game->cell_count * sizeof(int));
+    if (!game->body || !game->occupied || !game->free_cells || !game->free_position) {
+        snake_game_free(game);
+        return -1;
+    }
+
+    snake_game_reset(game, seed);
+    return 0;
+}
+
+void snake_game_reset(snake_game_t* game, uint64_t seed) {
+    // Position initiale au centre
+    int start_x = game->config.width / 2;
+    int start_y = game->config.height / 2;
+
+    // Serpent d'un segment
+    game->head = 0;
+    game->length = 1;
+    game->body[0].x = (int16_t)start_x;
+    game->body[0].y = (int16_t)start_y;
+    clear_grid(game);
+    occupy_cell(game, start_x, start_y);
+
+    // Configuration initiale
+    game->direction = SNAKE_RIGHT;
+    game->score = 0;
+    game->state = SNAKE_RUNNING;
+
+    // Générateur propre à la partie : même graine, mêmes pommes
+    rng_seed(&game->rng, seed);
+    spawn_new_apple(game);
+}
+
+void snake_game_free(snake_game_t* game) {
+    free(game->body);
+    free(game->occupied);
+    free(game->free_cells);
+    free(game->free_position);
+    game->body = NULL;
+    game->occupied = NULL;
+    game->free_cells = NULL;
+    game->free_position = NULL;
+    game->length = 0;
+    game->free_count = 0;
+}
+
+void snake_turn(snake_game_t* game, SnakeDirection direction) {
+    static const SnakeDirection opposite[] = {
+        [SNAKE_UP] = SNAKE_DOWN,
+        [SNAKE_DOWN] = SNAKE_UP,
+        [SNAKE_LEFT] = SNAKE_RIGHT,
+        [SNAKE_RIGHT] = SNAKE_LEFT
+    };
+
+    if (direction != opposite[game->direction]) {
+        game->direction = direction;
+    }
+}
+
+SnakeState snake_step(snake_game_t* game, SnakeDirection action) {
+    if (game->state != SNAKE_RUNNING) {
+        return game->state;
+    }
+
+    // Direction du tick (un demi-tour est ignoré)
+    snake_turn(game, action);
+
+    // Case visée par la tête
+    int x = game->body[game->head].x;
+    int y = game->body[game->head].y;
+    switch (game->direction) {
+        case SNAKE_UP:    y--; break;
+        case SNAKE_DOWN:  y++; break;
+        case SNAKE_LEFT:  x--; break;
+        case SNAKE_RIGHT: x++; break;
+    }
+
+    // Vérifie les collisions (la queue compte encore : elle n'a pas bougé)
+    if (is_wall(game, x, y) || snake_is_occupied(game, x, y)) {
+        game->state = SNAKE_LOST;
+        return game->state;
+    }
+
+    // Vérifie si une pomme est mangée
+    const int ate = (x == game->apple_x && y == game->apple_y);
+    push_head(game, x, y, ate);
+    if (ate) {
+        game->score++;
+        
+        // Vérifie la victoire
+        if (game->score >= game->config.target_score) {
+            game->state = SNAKE_WON;
+            return game->state;
+        }
+
+        // Place une nouvelle pomme, s'il reste de la place
+        if (!spawn_new_apple(game)) {
+            game->state = SNAKE_FULL;
+        }
+    }
+
+    return game->state;
+}
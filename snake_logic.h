@@ -0,0 +1,212 @@
+/**
+ * @file snake_logic.h
+ * @brief Règles du mini-jeu Snake, sans SDL
+ *
+ * Une partie avance d'un tick à chaque appel de snake_step(), avec la
+ * direction choisie par le joueur ou par un pilote automatique : pas
+ * d'horloge, pas de fenêtre. La même graine et les mêmes actions redonnent
+ * exactement la même partie, ce qui permet de simuler des millions de
+ * ticks par seconde (benchmarks, tests de pilotes, non-régression).
+ * L'interface SDL (snake.h) affiche une partie et la fait avancer au
+ * rythme de SNAKE_SPEED.
+ */
+
+#ifndef SNAKE_LOGIC_H_
+#define SNAKE_LOGIC_H_
+
+#include <stdint.h>
+#include "./rng.h"
+
+/*********************************
+ * Configuration du Snake
+ *********************************/
+
+/** @brief Côté de la grille par défaut */
+#define SNAKE_DEFAULT_GRID_SIZE 20
+
+/** @brief Bornes du côté de la grille */
+#define SNAKE_MIN_GRID_SIZE 2
+#define SNAKE_MAX_GRID_SIZE 4096
+
+/** @brief Score nécessaire pour gagner, par défaut */
+#define SNAKE_DEFAULT_TARGET_SCORE 5
+
+/*********************************
+ * Énumérations
+ *********************************/
+
+/**
+ * @brief États possibles du mini-jeu Snake
+ */
+typedef enum {
+    SNAKE_NONE,     /**< État initial/invalide */
+    SNAKE_RUNNING,  /**< Partie en cours */
+    SNAKE_WON,      /**< Victoire (score atteint) */
+    SNAKE_LOST,     /**< Défaite (collision) */
+    SNAKE_FULL      /**< Grille remplie : plus de place pour une pomme */
+} SnakeState;
+
+/**
+ * @brief Directions possibles du serpent
+ */
+typedef enum {
+    SNAKE_UP,     /**< Déplacement vers le haut */
+    SNAKE_DOWN,   /**< Déplacement vers le bas */
+    SNAKE_LEFT,   /**< Déplacement vers la gauche */
+    SNAKE_RIGHT   /**< Déplacement vers la droite */
+} SnakeDirection;
+
+/*********************************
+ * Structures
+ *********************************/
+
+/**
+ * @brief Paramètres d'une partie de Snake, choisis au lancement du jeu
+ */
+typedef struct {
+    int width;         /**< Largeur de la grille (cases) */
+    int height;        /**< Hauteur de la grille (cases) */
+    int target_score;  /**< Pommes à manger pour gagner */
+} snake_config_t;
+
+/**
+ * @brief Segment du corps du serpent : une case de la grille
+ */
+typedef struct {
+    int16_t x;  /**< Position X sur la grille */
+    int16_t y;  /**< Position Y sur la grille */
+} SnakeSegment;
+
+/**
+ * @brief État d'une partie de Snake
+ *
+ * Les tableaux sont alloués une fois pour toutes par snake_game_init(),
+ * à la taille de la grille : une partie n'alloue plus rien ensuite.
+ *
+ * Le corps est un tampon circulaire d'une case par case de la grille :
+ * la tête est body[head], la queue length - 1 cases avant (modulo
+ * cell_count). Avancer écrit la nouvelle tête et oublie la queue sans
+ * déplacer les autres segments ; grandir garde simplement la queue.
+ *
+ * occupied a un bit par case de la grille (y * width + x), levé tant
+ * qu'un segment s'y trouve : tester une case ne parcourt pas le serpent.
+ *
+ * Les cases libres forment un ensemble indexable : free_cells[0 ..
+ * free_count - 1] les liste dans un ordre quelconque et free_position
+ * donne la place de chacune dans cette liste. Ajouter ou retirer une case
+ * (échange avec la dernière) et tirer une case libre au hasard se font
+ * en temps constant, quel que soit le remplissage de la grille.
+ */
+typedef struct {
+    snake_config_t config;   /**< Dimensions de la grille et score à atteindre */
+    int cell_count;          /**< Nombre de cases de la grille */
+    SnakeSegment* body;      /**< Segments, tampon circulaire de cell_count cases */
+    int head;                /**< Indice de la tête dans body */
+    int length;              /**< Nombre de segments */
+    uint64_t* occupied;      /**< Cases occupées par le serpent, un bit par case */
+    int* free_cells;         /**< Cases libres, dans les free_count premiers éléments */
+    int* free_position;      /**< Place de chaque case libre dans free_cells */
+    int free_count;          /**< Nombre de cases libres */
+    SnakeDirection direction; /**< Direction actuelle */
+    int apple_x;             /**< Position X de la pomme */
+    int apple_y;             /**< Position Y de la pomme */
+    int score;               /**< Score actuel */
+    SnakeState state;        /**< État du jeu */
+    rng_t rng;               /**< Générateur des positions de pomme */
+} snake_game_t;
+
+/*********************************
+ * Accès au serpent
+ *********************************/
+
+/**
+ * @brief i-ème segment du serpent en partant de la queue
+ *
+ * @param game État de la partie
+ * @param i Rang du segment (0 pour la queue, length - 1 pour la tête)
+ * @return Segment correspondant du tampon circulaire
+ */
+static inline const SnakeSegment* snake_segment(const snake_game_t* game, int i) {
+    int index = game->head - game->length + 1 + i;
+    if (index < 0) {
+        index += game->cell_count;
+    }
+    return &game->body[index];
+}
+
+/**
+ * @brief Vérifie si une case de la grille est occupée par le serpent
+ *
+ * @param game État de la partie
+ * @param x Position X (dans la grille)
+ * @param y Position Y (dans la grille)
+ * @return 1 si un segment s'y trouve, 0 sinon
+ */
+static inline int snake_is_occupied(const snake_game_t* game, int x, int y) {
+    const int cell = y * game->config.width + x;
+    return (int)((game->occupied[cell / 64] >> (cell % 64)) & 1);
+}
+
+/*********************************
+ * Fonctions publiques
+ *********************************/
+
+/**
+ * @brief Vérifie des paramètres de partie
+ *
+ * @param config Paramètres à vérifier
+ * @return 1 si la grille a entre SNAKE_MIN_GRID_SIZE et SNAKE_MAX_GRID_SIZE
+ *         cases de côté et le score à atteindre est positif, 0 sinon
+ */
+int snake_config_is_valid(const snake_config_t* config);
+
+/**
+ * @brief Commence une partie : serpent d'un segment au centre, vers la droite
+ *
+ * @param game Partie à initialiser (libérée par snake_game_free())
+ * @param config Dimensions de la grille et score à atteindre (valides)
+ * @param seed Graine du générateur des pommes
+ * @return 0 en cas de succès, -1 si la mémoire manque
+ */
+int snake_game_init(snake_game_t* game, const snake_config_t* config, uint64_t seed);
+
+/**
+ * @brief Recommence une partie sur la même grille, sans allouer
+ *
+ * Pour enchaîner des parties : O(nombre de cases), comme snake_game_init().
+ *
+ * @param game Partie initialisée par snake_game_init()
+ * @param seed Graine du générateur des pommes
+ */
+void snake_game_reset(snake_game_t* game, uint64_t seed);
+
+/**
+ * @brief Libère les tableaux de la partie
+ */
+void snake_game_free(snake_game_t* game);
+
+/**
+ * @brief Change la direction du serpent
+ *
+ * Un demi-tour (direction opposée à la direction actuelle) est ignoré.
+ *
+ * @param game État de la partie
+ * @param direction Direction demandée
+ */
+void snake_turn(snake_game_t* game, SnakeDirection direction);
+
+/**
+ * @brief Joue un tick de la partie
+ *
+ * Tourne dans la direction demandée (snake_turn()), avance la tête, puis
+ * gère les collisions, la pomme, le score et la fin de partie. Ne fait
+ * rien si la partie est terminée. O(1), sans allocation.
+ *
+ * @param game État de la partie
+ * @param action Direction voulue pour ce tick (game->direction pour
+ *               continuer tout droit)
+ * @return État de la partie après le tick
+ */
+SnakeState snake_step(snake_game_t* game, SnakeDirection action);
+
+#endif  /* SNAKE_LOGIC_H_ */
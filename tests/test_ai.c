@@ -0,0 +1,108 @@
+/**
+ * @file test_ai.c
+ * @brief Tests de non-régression de la recherche de l'IA
+ *
+ * Compilé avec AI_NO_LOOKUP_TABLE : sur le plateau 3x3, c'est la recherche
+ * elle-même qui est testée, pas la table précalculée (ai_table.h).
+ *
+ * Usage : test_ai   (code de retour non nul en cas d'échec)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../game.h"
+#include "../logic.h"
+#include "../ai.h"
+
+/** @brief Nombre de vérifications en échec */
+static int failures = 0;
+
+/**
+ * @brief Vérifie que le coup de l'IA fait partie des coups attendus
+ *
+ * @param expected Masque des coups acceptés (bit i pour la case i)
+ */
+static void expect_move(const char* name, int move, unsigned int expected) {
+    if (move < 0 || !((expected >> move) & 1)) {
+        fprintf(stderr, "ÉCHEC %s : coup %d, attendus 0x%03x\n", name, move, expected);
+        failures++;
+    } else {
+        printf("ok     %s\n", name);
+    }
+}
+
+/**
+ * @brief Décode une position 3x3 en base 3 (codage de ai_table.h)
+ */
+static void decode_position(int index, game_t* game, int player) {
+    reset_game(game);
+    for (int i = 0; i < 9; i++) {
+        const int cell = index % 3;
+        index /= 3;
+        if (cell != EMPTY) {
+            make_move(game, i, cell);
+        }
+    }
+    game->state = RUNNING_STATE;
+    game->player = player;
+}
+
+/**
+ * @brief Prépare une IA de niveau difficile, sans limite de temps
+ */
+static void setup_ai(ai_t* ai, int thread_count) {
+    init_ai(ai, HARD);
+    ai->time_limit_ms = 0;
+    ai->thread_count = thread_count;
+}
+
+/**
+ * @brief Victoire la plus rapide, même avec une table déjà remplie
+ *
+ * O en 0 et 3, X en 5 et 6, X au trait (index 1028) : jouer 2 ou 8
+ * (fourchette) gagne en 3 demi-coups, jouer 1 seulement en 5. Les mats
+ * plus lointains laissés dans la table par les positions résolues avant
+ * ne doivent pas arrêter l'approfondissement itératif sur la victoire la
+ * plus lente.
+ */
+static void test_shortest_win(void) {
+    const int position = 1028;
+    const unsigned int expected = 1u << 2 | 1u << 8;
+    game_t game = {0};
+    game.config = get_board_config(3, 3, 3);
+    ai_t ai;
+
+    setup_ai(&ai, 1);
+    decode_position(position, &game, PLAYER_X);
+    expect_move("victoire la plus rapide, table vide", ai_get_move(&game, &ai), expected);
+
+    // Toutes les positions précédentes résolues avec la même table,
+    // dans l'ordre de tools/gen_ai_table.c
+    for (int threads = 1; threads <= 2; threads++) {
+        setup_ai(&ai, threads);
+        for (int index = 0; index < position; index++) {
+            for (int side = PLAYER_X; side <= PLAYER_O; side++) {
+                decode_position(index, &game, side);
+                if (!check_player_won(&game, PLAYER_X) && !check_player_won(&game, PLAYER_O) &&
+                    !is_board_full(&game)) {
+                    ai_get_move(&game, &ai);
+                }
+            }
+        }
+        decode_position(position, &game, PLAYER_X);
+        expect_move(threads == 1 ? "victoire la plus rapide, table remplie, 1 thread"
+                                 : "victoire la plus rapide, table remplie, 2 threads",
+                    ai_get_move(&game, &ai), expected);
+    }
+}
+
+int main(void) {
+    test_shortest_win();
+
+    if (failures > 0) {
+        fprintf(stderr, "%d test(s) en échec\n", failures);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
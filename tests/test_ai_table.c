@@ -0,0 +1,126 @@
+/**
+ * @file test_ai_table.c
+ * @brief Vérifie la table de coups parfaits 3x3 (ai_table.h)
+ *
+ * Chaque position atteignable en partie (écart d'au plus un pion entre
+ * les joueurs, pas de gagnant, plateau non plein) est résolue par un
+ * Minimax exhaustif, sans table de transposition ni élagage. Le coup de
+ * la table doit atteindre le meilleur score : victoire la plus rapide,
+ * défaite la plus lente, sinon nul.
+ *
+ * Usage : test_ai_table   (code de retour non nul en cas d'échec)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../game.h"
+#include "../logic.h"
+#include "../ai.h"
+#include "../ai_table.h"
+
+/**
+ * @brief Minimax exhaustif, du point de vue du joueur au trait
+ *
+ * Même barème que la recherche de l'IA : une victoire au demi-coup ply
+ * vaut SCORE_WIN - ply.
+ */
+static int exhaustive_score(game_t* game, int player, int ply) {
+    if (is_board_full(game)) {
+        return SCORE_DRAW;
+    }
+
+    const int opponent = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    int best = SCORE_LOSS - 1;
+    for (int cell = 0; cell < AI_TABLE_CELLS; cell++) {
+        if (get_cell(game, cell) != EMPTY) {
+            continue;
+        }
+        int score;
+        if (make_move(game, cell, player)) {
+            score = SCORE_WIN - (ply + 1);
+        } else {
+            score = -exhaustive_score(game, opponent, ply + 1);
+        }
+        unmake_move(game, cell, player);
+        if (score > best) {
+            best = score;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Score exhaustif d'un coup précis du joueur au trait
+ */
+static int move_score(game_t* game, int player, int cell) {
+    const int opponent = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+    int score;
+    if (make_move(game, cell, player)) {
+        score = SCORE_WIN - 1;
+    } else {
+        score = -exhaustive_score(game, opponent, 1);
+    }
+    unmake_move(game, cell, player);
+    return score;
+}
+
+/**
+ * @brief Décode une position en base 3 (codage de ai_table.h)
+ */
+static void decode_position(int index, game_t* game) {
+    reset_game(game);
+    for (int i = 0; i < AI_TABLE_CELLS; i++) {
+        const int cell = index % 3;
+        index /= 3;
+        if (cell != EMPTY) {
+            make_move(game, i, cell);
+        }
+    }
+}
+
+int main(void) {
+    game_t game = {0};
+    game.config = get_board_config(3, 3, 3);
+    int checked = 0;
+    int failures = 0;
+
+    for (int index = 0; index < AI_TABLE_POSITIONS; index++) {
+        decode_position(index, &game);
+        if (check_player_won(&game, PLAYER_X) || check_player_won(&game, PLAYER_O) ||
+            is_board_full(&game)) {
+            continue;
+        }
+
+        const int x_count = count_cells(&game, PLAYER_X);
+        const int o_count = count_cells(&game, PLAYER_O);
+        for (int side = PLAYER_X; side <= PLAYER_O; side++) {
+            // Chaque joueur peut avoir commencé : le joueur au trait n'a
+            // jamais plus de pions que l'autre, ni plus d'un de moins
+            const int own = (side == PLAYER_X) ? x_count : o_count;
+            const int other = (side == PLAYER_X) ? o_count : x_count;
+            if (own != other && own != other - 1) {
+                continue;
+            }
+
+            const int move = ai_table_moves[PLAYER_INDEX(side)][index];
+            const int best = exhaustive_score(&game, side, 0);
+            checked++;
+            if (move < 0 || move >= AI_TABLE_CELLS || get_cell(&game, move) != EMPTY) {
+                fprintf(stderr, "ÉCHEC position %d, joueur %d : coup %d injouable\n",
+                        index, side, move);
+                failures++;
+            } else {
+                const int score = move_score(&game, side, move);
+                if (score != best) {
+                    fprintf(stderr, "ÉCHEC position %d, joueur %d : coup %d (%d au lieu de %d)\n",
+                            index, side, move, score, best);
+                    failures++;
+                }
+            }
+        }
+    }
+
+    printf("%d positions vérifiées, %d en échec\n", checked, failures);
+    return (failures > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file test_logic.c
+ * @brief Tests de non-régression des règles : historique des coups
+ *
+ * Usage : test_logic   (code de retour non nul en cas d'échec)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../game.h"
+#include "../logic.h"
+
+/** @brief Nombre de vérifications en échec */
+static int failures = 0;
+
+/**
+ * @brief Vérifie une condition et signale son échec
+ */
+static void expect(const char* name, int condition) {
+    if (!condition) {
+        fprintf(stderr, "ÉCHEC %s\n", name);
+        failures++;
+    } else {
+        printf("ok     %s\n", name);
+    }
+}
+
+/**
+ * @brief Commence une partie sur un plateau 3x3
+ */
+static void new_game(game_t* game) {
+    game->config = get_board_config(3, 3, 3);
+    reset_game(game);
+}
+
+/**
+ * @brief Annuler puis rejouer redonne la même position et le même joueur
+ */
+static void test_undo_redo(void) {
+    game_t game = {0};
+    new_game(&game);
+    click_on_cell(&game, 0, 0);
+    click_on_cell(&game, 1, 1);
+
+    expect("annulation", undo_move(&game) && get_cell(&game, 4) == EMPTY &&
+                         game.player == PLAYER_O && game.redo_count == 1);
+    expect("rejeu", redo_move(&game) && get_cell(&game, 4) == PLAYER_O &&
+                    game.player == PLAYER_X && game.redo_count == 0);
+}
+
+/**
+ * @brief Un nouveau coup oublie les coups annulés
+ */
+static void test_move_clears_redo(void) {
+    game_t game = {0};
+    new_game(&game);
+    click_on_cell(&game, 0, 0);
+    click_on_cell(&game, 1, 1);
+    undo_move(&game);
+    click_on_cell(&game, 2, 2);
+
+    expect("coup après annulation", game.redo_count == 0 && !redo_move(&game) &&
+                                     get_cell(&game, 8) == PLAYER_O);
+}
+
+/**
+ * @brief Annuler le coup gagnant remet la partie en cours
+ */
+static void test_undo_win(void) {
+    game_t game = {0};
+    new_game(&game);
+    static const int moves[][2] = {{0, 0}, {1, 0}, {0, 1}, {1, 1}, {0, 2}};
+    for (int i = 0; i < 5; i++) {
+        click_on_cell(&game, moves[i][0], moves[i][1]);
+    }
+    expect("victoire", game.state == PLAYER_X_WON_STATE);
+
+    undo_move(&game);
+    expect("victoire annulée", game.state == RUNNING_STATE && game.winner == EMPTY &&
+                               game.player == PLAYER_X);
+}
+
+/**
+ * @brief Une manche de Snake perdue oublie les coups annulés
+ *
+ * Après une annulation, le joueur qui perd sa manche de Snake passe son
+ * tour : rejouer ne doit ni lui rendre la main ni poser le symbole qu'il
+ * n'a pas gagné.
+ */
+static void test_skip_clears_redo(void) {
+    game_t game = {0};
+    new_game(&game);
+    click_on_cell(&game, 0, 0);
+    click_on_cell(&game, 1, 1);
+    undo_move(&game);
+    skip_turn(&game);
+
+    expect("tour passé", game.player == PLAYER_X && game.redo_count == 0);
+    expect("rejeu après tour passé", !redo_move(&game) && get_cell(&game, 4) == EMPTY &&
+                                     game.player == PLAYER_X);
+}
+
+int main(void) {
+    test_undo_redo();
+    test_move_clears_redo();
+    test_undo_win();
+    test_skip_clears_redo();
+
+    if (failures > 0) {
+        fprintf(stderr, "%d test(s) en échec\n", failures);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file gen_ai_table.c
+ * @brief Générateur de la table de coups parfaits 3x3 (voir ai_table.h)
+ *
+ * Parcourt les 3^9 positions, résout chacune pour les deux joueurs au trait
+ * avec la recherche du niveau difficile et écrit le fichier C correspondant.
+ * Chaque position est résolue par une IA neuve, sur un seul thread : la
+ * table ne dépend pas de l'ordre de parcours ni de la machine.
+ * tests/test_ai_table.c vérifie ensuite chaque coup.
+ * Ce programme est compilé avec AI_NO_LOOKUP_TABLE pour que ai.c n'utilise
+ * pas la table qu'il est en train de produire.
+ *
+ * Usage : gen_ai_table <fichier de sortie>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../game.h"
+#include "../logic.h"
+#include "../ai.h"
+#include "../ai_table.h"
+
+/**
+ * @brief Décode un index en base 3 vers un état de jeu
+ */
+static void decode_position(int index, game_t* game) {
+    reset_game(game);
+
+    for (int i = 0; i < AI_TABLE_CELLS; i++) {
+        int cell = index % 3;
+        index /= 3;
+        if (cell != EMPTY) {
+            make_move(game, i, cell);
+        }
+    }
+}
+
+/**
+ * @brief Résout une position avec une IA neuve
+ *
+ * Table de transposition vide et un seul thread : le coup ne dépend ni
+ * des positions résolues avant, ni de l'ordre d'arrivée des threads, ni
+ * du nombre de cœurs de la machine qui génère la table.
+ */
+static int solve_position(game_t* game, ai_t* ai) {
+    init_ai(ai, HARD);
+    ai->time_limit_ms = 0;  // La table doit contenir des coups exacts
+    ai->thread_count = 1;
+    return ai_get_move(game, ai);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage : %s <fichier de sortie>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    FILE* out = fopen(argv[1], "w");
+    if (!out) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    fprintf(out, "/* Fichier généré par tools/gen_ai_table.c, ne pas modifier. */\n\n");
+    fprintf(out, "#include \"ai_table.h\"\n");
+
+    static int8_t moves[2][AI_TABLE_POSITIONS];
+    game_t game = {0};
+    game.config = get_board_config(3, 3, 3);
+    ai_t ai;
+
+    for (int index = 0; index < AI_TABLE_POSITIONS; index++) {
+        decode_position(index, &game);
+        game.state = RUNNING_STATE;
+
+        int terminal = check_player_won(&game, PLAYER_X)
+                    || check_player_won(&game, PLAYER_O)
+                    || is_board_full(&game);
+
+        for (int side = PLAYER_X; side <= PLAYER_O; side++) {
+            game.player = side;
+            moves[PLAYER_INDEX(side)][index] = terminal ? -1 : (int8_t)solve_position(&game, &ai);
+        }
+    }
+
+    fprintf(out, "\nconst uint16_t ai_table_base3[1 << AI_TABLE_CELLS] = {");
+    for (int mask = 0; mask < (1 << AI_TABLE_CELLS); mask++) {
+        int value = 0;
+        for (int i = AI_TABLE_CELLS - 1; i >= 0; i--) {
+            value = value * 3 + ((mask >> i) & 1);
+        }
+        fprintf(out, "%s%d,", (mask % 16) ? " " : "\n    ", value);
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "const int8_t ai_table_moves[2][AI_TABLE_POSITIONS] = {\n");
+    for (int side = 0; side < 2; side++) {
+        fprintf(out, "    {");
+        for (int index = 0; index < AI_TABLE_POSITIONS; index++) {
+            fprintf(out, "%s%d,", (index % 24) ? " " : "\n        ", moves[side][index]);
+        }
+        fprintf(out, "\n    },\n");
+    }
+    fprintf(out, "};\n");
+
+    if (fclose(out) != 0) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,374 @@
+/**
+ * @file tournament.c
+ * @brief Tournoi IA contre IA sans fenêtre, réparti sur tous les cœurs
+ *
+ * Fait jouer un grand nombre de parties entre deux niveaux de l'IA (X
+ * commence toujours) et affiche les taux de victoire et de nul, le débit
+ * en parties et en coups par seconde, et les centiles du temps de
+ * réflexion par coup de chaque joueur.
+ *
+ * N'utilise que la bibliothèque ttt_core : ni SDL ni fenêtre.
+ *
+ * Chaque thread joue ses parties avec sa propre copie des IA et une
+ * recherche séquentielle (thread_count = 1) : le parallélisme vient des
+ * parties simultanées, pas de la recherche.
+ *
+ * Les générateurs des deux IA sont réinitialisés au début de chaque
+ * partie à partir de la graine et du numéro de la partie : les résultats
+ * ne dépendent ni du nombre de threads ni de l'ordre des parties (sauf
+ * pour les niveaux limités en temps plutôt qu'en simulations).
+ *
+ * Usage : tournament [--size LARGEURxHAUTEUR] [--win K] [--games N]
+ *                    [--threads T] [--x NIVEAU] [--o NIVEAU]
+ *                    [--time MS] [--playouts N] [--seed N]
+ *         NIVEAU : easy, medium, hard ou expert
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../ttt_core.h"
+
+/*********************************
+ * Configuration
+ *********************************/
+
+/** @brief Nombre de parties par défaut */
+#define TOURNAMENT_DEFAULT_GAMES 10000
+
+/** @brief Temps de réflexion par coup par défaut (niveaux difficile et expert) */
+#define TOURNAMENT_DEFAULT_TIME_MS 20
+
+/** @brief Subdivisions de chaque puissance de 2 dans l'histogramme des latences */
+#define LATENCY_STEPS_PER_OCTAVE 8
+
+/** @brief Puissances de 2 couvertes, en nanosecondes (jusqu'à 2^40 ns, 18 minutes) */
+#define LATENCY_OCTAVES 40
+
+/** @brief Nombre de cases de l'histogramme des latences */
+#define LATENCY_BUCKETS (LATENCY_OCTAVES * LATENCY_STEPS_PER_OCTAVE)
+
+/**
+ * @brief Histogramme logarithmique des temps de réflexion
+ *
+ * La case b compte les coups dont la durée en nanosecondes est comprise
+ * entre 2^(b/8) et 2^((b+1)/8) : un centile est lu à 9 % près, sans
+ * conserver les millions de mesures.
+ */
+typedef struct {
+    unsigned long counts[LATENCY_BUCKETS];
+    unsigned long total;
+    double max_ns;
+} latency_histogram_t;
+
+/** @brief Résultats d'un thread, fusionnés à la fin du tournoi */
+typedef struct {
+    unsigned long games;
+    unsigned long wins[2];                /**< Victoires de X puis de O */
+    unsigned long draws;
+    unsigned long moves;
+    latency_histogram_t latency[2];       /**< Temps de réflexion de X puis de O */
+} tournament_result_t;
+
+/** @brief Paramètres partagés par les threads */
+typedef struct {
+    const board_config_t* config;
+    ai_t players[2];                      /**< IA de X puis de O, copiées par chaque thread */
+    unsigned long games;                  /**< Nombre total de parties */
+    uint64_t seed;                        /**< Graine du tournoi */
+    atomic_ulong next_game;               /**< Prochaine partie à distribuer */
+} tournament_t;
+
+/** @brief Données d'un thread du tournoi */
+typedef struct {
+    pthread_t thread;
+    tournament_t* tournament;
+    tournament_result_t result;
+} tournament_worker_t;
+
+/*********************************
+ * Fonctions utilitaires statiques
+ *********************************/
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void latency_record(latency_histogram_t* histogram, double ns) {
+    int bucket = (ns > 1.0) ? (int)(log2(ns) * LATENCY_STEPS_PER_OCTAVE) : 0;
+    if (bucket >= LATENCY_BUCKETS) {
+        bucket = LATENCY_BUCKETS - 1;
+    }
+    histogram->counts[bucket]++;
+    histogram->total++;
+    if (ns > histogram->max_ns) {
+        histogram->max_ns = ns;
+    }
+}
+
+static void latency_merge(latency_histogram_t* into, const latency_histogram_t* from) {
+    for (int b = 0; b < LATENCY_BUCKETS; b++) {
+        into->counts[b] += from->counts[b];
+    }
+    into->total += from->total;
+    if (from->max_ns > into->max_ns) {
+        into->max_ns = from->max_ns;
+    }
+}
+
+/**
+ * @brief Centile des temps de réflexion
+ * @param histogram Histogramme non vide
+ * @param fraction Part des coups plus rapides (0.5 pour la médiane)
+ * @return Borne supérieure de la case du centile, en nanosecondes
+ */
+static double latency_percentile(const latency_histogram_t* histogram, double fraction) {
+    const unsigned long rank = (unsigned long)ceil(fraction * histogram->total);
+    unsigned long seen = 0;
+    for (int b = 0; b < LATENCY_BUCKETS; b++) {
+        seen += histogram->counts[b];
+        if (seen >= rank && seen > 0) {
+            const double upper = exp2((b + 1) / (double)LATENCY_STEPS_PER_OCTAVE);
+            return (upper < histogram->max_ns) ? upper : histogram->max_ns;
+        }
+    }
+    return histogram->max_ns;
+}
+
+/**
+ * @brief Affiche une durée en nanosecondes avec une unité lisible
+ */
+static void print_duration(double ns) {
+    if (ns < 1e3) {
+        printf(" %8.0f ns", ns);
+    } else if (ns < 1e6) {
+        printf(" %8.2f us", ns * 1e-3);
+    } else {
+        printf(" %8.2f ms", ns * 1e-6);
+    }
+}
+
+static const char* level_name(AIDifficulty difficulty) {
+    switch (difficulty) {
+        case EASY: return "easy";
+        case MEDIUM: return "medium";
+        case HARD: return "hard";
+        case EXPERT: return "expert";
+        default: return "?";
+    }
+}
+
+/**
+ * @brief Lit un niveau de l'IA
+ * @return 0 en cas de succès, -1 si le nom est inconnu
+ */
+static int parse_level(const char* name, AIDifficulty* difficulty) {
+    const AIDifficulty levels[] = { EASY, MEDIUM, HARD, EXPERT };
+    for (size_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        if (strcmp(name, level_name(levels[l])) == 0) {
+            *difficulty = levels[l];
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/*********************************
+ * Déroulement du tournoi
+ *********************************/
+
+/**
+ * @brief Joue une partie complète entre les deux IA
+ */
+static void play_game(const board_config_t* config, ai_t players[2], tournament_result_t* result) {
+    game_t game = {0};
+    game.config = config;
+    game.is_ai_mode = 1;
+    reset_game(&game);
+
+    while (game.state == RUNNING_STATE) {
+        const int side = PLAYER_INDEX(game.player);
+
+        const double start = now_ns();
+        const int move = ai_get_move(&game, &players[side]);
+        latency_record(&result->latency[side], now_ns() - start);
+
+        if (move < 0) {
+            break;
+        }
+        player_turn(&game, move / config->width, move % config->width);
+        result->moves++;
+    }
+
+    result->games++;
+    if (game.state == PLAYER_X_WON_STATE) {
+        result->wins[PLAYER_INDEX(PLAYER_X)]++;
+    } else if (game.state == PLAYER_O_WON_STATE) {
+        result->wins[PLAYER_INDEX(PLAYER_O)]++;
+    } else {
+        result->draws++;
+    }
+}
+
+static void* tournament_thread_main(void* arg) {
+    tournament_worker_t* worker = (tournament_worker_t*)arg;
+    tournament_t* tournament = worker->tournament;
+
+    ai_t players[2] = { tournament->players[0], tournament->players[1] };
+    unsigned long index;
+    while ((index = atomic_fetch_add(&tournament->next_game, 1)) < tournament->games) {
+        ai_seed(&players[0], tournament->seed + 2 * index);
+        ai_seed(&players[1], tournament->seed + 2 * index + 1);
+        play_game(tournament->config, players, &worker->result);
+    }
+
+    mcts_free();
+    return NULL;
+}
+
+/**
+ * @brief Affiche les temps de réflexion d'un joueur
+ */
+static void print_latency(const char* label, AIDifficulty difficulty,
+                          const latency_histogram_t* histogram) {
+    if (histogram->total == 0) {
+        return;
+    }
+    printf("%s %-7s", label, level_name(difficulty));
+    print_duration(latency_percentile(histogram, 0.50));
+    print_duration(latency_percentile(histogram, 0.90));
+    print_duration(latency_percentile(histogram, 0.99));
+    print_duration(histogram->max_ns);
+    printf("\n");
+}
+
+int main(int argc, char* argv[]) {
+    int width = 3, height = 3, win_length = 0;
+    unsigned long games = TOURNAMENT_DEFAULT_GAMES;
+    int thread_count = 0;
+    AIDifficulty levels[2] = { HARD, MEDIUM };
+    int time_ms = TOURNAMENT_DEFAULT_TIME_MS;
+    unsigned long playouts = 0;
+    unsigned long long seed = AI_DEFAULT_SEED;
+
+    int valid = 1;
+    for (int i = 1; i < argc && valid; i++) {
+        const int has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--size") == 0 && has_value) {
+            valid = sscanf(argv[++i], "%dx%d", &width, &height) == 2;
+        } else if (strcmp(argv[i], "--win") == 0 && has_value) {
+            valid = sscanf(argv[++i], "%d", &win_length) == 1;
+        } else if (strcmp(argv[i], "--games") == 0 && has_value) {
+            valid = sscanf(argv[++i], "%lu", &games) == 1 && games > 0;
+        } else if (strcmp(argv[i], "--threads") == 0 && has_value) {
+            valid = sscanf(argv[++i], "%d", &thread_count) == 1 && thread_count > 0;
+        } else if (strcmp(argv[i], "--x") == 0 && has_value) {
+            valid = parse_level(argv[++i], &levels[0]) == 0;
+        } else if (strcmp(argv[i], "--o") == 0 && has_value) {
+            valid = parse_level(argv[++i], &levels[1]) == 0;
+        } else if (strcmp(argv[i], "--time") == 0 && has_value) {
+            valid = sscanf(argv[++i], "%d", &time_ms) == 1 && time_ms > 0;
+        } else if (strcmp(argv[i], "--playouts") == 0 && has_value) {
+            valid = sscanf(argv[++i], "%lu", &playouts) == 1;
+        } else if (strcmp(argv[i], "--seed") == 0 && has_value) {
+            valid = sscanf(argv[++i], "%llu", &seed) == 1;
+        } else {
+            valid = 0;
+        }
+    }
+
+    // Par défaut, il faut remplir une ligne du plus petit côté
+    if (win_length == 0) {
+        win_length = (width < height) ? width : height;
+    }
+    const board_config_t* config = valid ? get_board_config(width, height, win_length) : NULL;
+    if (!config) {
+        fprintf(stderr, "Usage : %s [--size LARGEURxHAUTEUR] [--win K] [--games N] "
+                        "[--threads T]\n"
+                        "       [--x NIVEAU] [--o NIVEAU] [--time MS] [--playouts N] [--seed N]\n"
+                        "  NIVEAU : easy, medium, hard, expert\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (thread_count == 0) {
+        thread_count = ai_default_thread_count();
+    }
+
+    // init_ai vide les tables partagées : les deux IA sont prêtes avant
+    // le démarrage des threads
+    static tournament_t tournament;
+    tournament.config = config;
+    tournament.games = games;
+    tournament.seed = seed;
+    atomic_init(&tournament.next_game, 0);
+    for (int p = 0; p < 2; p++) {
+        ai_t* ai = &tournament.players[p];
+        init_ai(ai, levels[p]);
+        ai->thread_count = 1;
+        ai->time_limit_ms = time_ms;
+        ai->time_budget_ms = time_ms;
+        ai->playout_budget = playouts;
+    }
+
+    tournament_worker_t* workers = calloc(thread_count, sizeof(tournament_worker_t));
+    if (!workers) {
+        fprintf(stderr, "Erreur allocation threads\n");
+        return EXIT_FAILURE;
+    }
+
+    const double start = now_ns();
+    int started = 0;
+    for (; started < thread_count; started++) {
+        workers[started].tournament = &tournament;
+        if (pthread_create(&workers[started].thread, NULL, tournament_thread_main,
+                           &workers[started]) != 0) {
+            fprintf(stderr, "Erreur création thread %d\n", started);
+            break;
+        }
+    }
+
+    tournament_result_t total = {0};
+    for (int t = 0; t < started; t++) {
+        pthread_join(workers[t].thread, NULL);
+
+        const tournament_result_t* result = &workers[t].result;
+        total.games += result->games;
+        total.wins[0] += result->wins[0];
+        total.wins[1] += result->wins[1];
+        total.draws += result->draws;
+        total.moves += result->moves;
+        latency_merge(&total.latency[0], &result->latency[0]);
+        latency_merge(&total.latency[1], &result->latency[1]);
+    }
+    const double elapsed = (now_ns() - start) * 1e-9;
+    free(workers);
+
+    if (total.games == 0) {
+        return EXIT_FAILURE;
+    }
+
+    printf("%dx%d, k=%d, X %s contre O %s, %lu parties, %d threads, graine %llu",
+           width, height, win_length, level_name(levels[0]), level_name(levels[1]),
+           total.games, started, seed);
+    if (levels[0] >= HARD || levels[1] >= HARD) {
+        printf(", %d ms par coup", time_ms);
+    }
+    printf("\n");
+    printf("victoires X %6.2f %%   victoires O %6.2f %%   nuls %6.2f %%\n",
+           100.0 * total.wins[0] / total.games, 100.0 * total.wins[1] / total.games,
+           100.0 * total.draws / total.games);
+    printf("%.2f s, %.0f parties/s, %.0f coups/s, %.1f coups par partie\n",
+           elapsed, total.games / elapsed, total.moves / elapsed,
+           (double)total.moves / total.games);
+    printf("réflexion         médiane          p90          p99          max\n");
+    print_latency("X", levels[0], &total.latency[0]);
+    print_latency("O", levels[1], &total.latency[1]);
+
+    return EXIT_SUCCESS;
+}
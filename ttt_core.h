@@ -0,0 +1,24 @@
+/**
+ * @file ttt_core.h
+ * @brief En-tête de la bibliothèque ttt_core : règles et IA, sans SDL
+ *
+ * Regroupe le plateau (game.h, bitboard.h), les règles (logic.h), l'IA
+ * (ai.h, mcts.h), les lots de parties (batch.h), les règles du Snake
+ * (snake_logic.h) et le générateur pseudo-aléatoire (rng.h). Les
+ * programmes sans fenêtre (tournoi, benchmarks, serveurs) n'ont besoin
+ * que de cet en-tête et de la bibliothèque ttt_core ; l'interface SDL
+ * s'ajoute par-dessus (window.h, rendering.h).
+ */
+
+#ifndef TTT_CORE_H_
+#define TTT_CORE_H_
+
+#include "./game.h"
+#include "./logic.h"
+#include "./ai.h"
+#include "./mcts.h"
+#include "./batch.h"
+#include "./rng.h"
+#include "./snake_logic.h"
+
+#endif  /* TTT_CORE_H_ */
@@ -3,7 +3,7 @@
  * @brief Gestion de la fenêtre et du redimensionnement
  */
 
-#include "./game.h"
+#include "./window.h"
 
 /**
  * @brief Met à jour les dimensions de la fenêtre et recalcule les éléments dépendants
@@ -13,25 +13,27 @@
  * - La taille des cellules
  * - La position des boutons du menu de victoire
  *
- * @param game État du jeu à mettre à jour
+ * @param ui Interface à mettre à jour
+ * @param config Plateau affiché
  * @param width Nouvelle largeur de la fenêtre
  * @param height Nouvelle hauteur de la fenêtre 
  */
-void update_window_dimensions(game_t* game, int width, int height) {
-    game->dimensions.window_width = width;
-    game->dimensions.window_height = height;
-    game->dimensions.cell_width = (float)width / N;
-    game->dimensions.cell_height = (float)height / N;
+void update_window_dimensions(game_ui_t* ui, const board_config_t* config,
+                              int width, int height) {
+    ui->dimensions.window_width = width;
+    ui->dimensions.window_height = height;
+    ui->dimensions.cell_width = (float)width / config->width;
+    ui->dimensions.cell_height = (float)height / config->height;
 
     // Met à jour les positions des boutons du menu de victoire
-    game->replay_button = (SDL_Rect){
+    ui->replay_button = (SDL_Rect){
         width / 4,
         2 * height / 3,
         width / 4,
         50
     };
 
-    game->menu_button = (SDL_Rect){
+    ui->menu_button = (SDL_Rect){
         2 * width / 4,
         2 * height / 3,
         width / 4,
@@ -46,17 +48,18 @@ void update_window_dimensions(game_t* game, int width, int height) {
  * après le changement de mode d'affichage.
  *
  * @param window Fenêtre SDL à modifier
- * @param game État du jeu à mettre à jour
+ * @param ui Interface à mettre à jour
+ * @param config Plateau affiché
  */
-void toggle_fullscreen(SDL_Window* window, game_t* game) {
+void toggle_fullscreen(SDL_Window* window, game_ui_t* ui, const board_config_t* config) {
     Uint32 fullscreen_flag = SDL_WINDOW_FULLSCREEN_DESKTOP;
     int is_fullscreen = SDL_GetWindowFlags(window) & fullscreen_flag;
     
     SDL_SetWindowFullscreen(window, is_fullscreen ? 0 : fullscreen_flag);
-    game->is_fullscreen = !is_fullscreen;
+    ui->is_fullscreen = !is_fullscreen;
     
     // Met à jour les dimensions
     int width, height;
     SDL_GetWindowSize(window, &width, &height);
-    update_window_dimensions(game, width, height);
+    update_window_dimensions(ui, config, width, height);
 }
\ No newline at end of file
@@ -16,7 +16,40 @@
 // Dimension minimale de la fenêtre
 #define MIN_WINDOW_SIZE 300
 
-void update_window_dimensions(game_t* game, int width, int height);
-void toggle_fullscreen(SDL_Window* window, game_t* game);
+typedef struct {
+    int window_width;
+    int window_height;
+    float cell_width;
+    float cell_height;
+} window_dimensions_t;
+
+/**
+ * @brief État de l'interface d'une partie
+ *
+ * Ce qui ne concerne que l'affichage et les clics, séparé de game_t pour
+ * que les règles et l'IA n'aient pas besoin de SDL.
+ */
+typedef struct {
+    /** @brief Dimensions de la fenêtre et des cases du plateau */
+    window_dimensions_t dimensions;
+
+    /** @brief Zone cliquable pour le bouton "Rejouer" */
+    SDL_Rect replay_button;
+
+    /** @brief Zone cliquable pour le bouton "Menu principal" */
+    SDL_Rect menu_button;
+
+    /**
+     * @brief Horodatage de la victoire
+     * Utilisé pour la temporisation de l'affichage de fin de partie
+     */
+    Uint32 victory_time;
+
+    int is_fullscreen;
+} game_ui_t;
+
+void update_window_dimensions(game_ui_t* ui, const board_config_t* config,
+                              int width, int height);
+void toggle_fullscreen(SDL_Window* window, game_ui_t* ui, const board_config_t* config);
 
 #endif /* WINDOW_H_ */
\ No newline at end of file